@@ -16,6 +16,7 @@ The motion is slow enough that relativistic effects are ignored.
 """
 
 import os
+import re
 import sys
 
 import numpy as np
@@ -131,5 +132,11 @@ assert abs(np.abs((ux - ux_sim) / ux)) < 0.002, Exception(
     "error in x particle velocity"
 )
 
+# With the cached Poisson operator and the extrapolated initial guess, the
+# electrostatic solver converges to the same solution, within the tolerance of MLMG
 test_name = os.path.split(os.getcwd())[1]
-checksumAPI.evaluate_checksum(test_name, filename)
+rtol = 1.0e-9
+if test_name.endswith("_cached_operator"):
+    test_name = re.sub("_cached_operator", "", test_name)
+    rtol = 1.0e-6
+checksumAPI.evaluate_checksum(test_name, filename, rtol=rtol)
@@ -111,5 +111,8 @@ post_processing_utils.check_random_filter(
     last_fn, random_filter_fn, random_fraction, dim, species_name
 )
 
+# With several boxes, the random numbers of the collisions differ from those of
+# the single-box benchmark, so that the test is only compared to the fit
 test_name = os.path.split(os.getcwd())[1]
-checksumAPI.evaluate_checksum(test_name, last_fn)
+if not test_name.endswith("_multi_box"):
+    checksumAPI.evaluate_checksum(test_name, last_fn)
@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 
 import os
+import re
 import sys
 
 sys.path.insert(1, "../../../../warpx/Regression/Checksum/")
@@ -9,8 +10,10 @@ import checksumAPI
 # this will be the name of the plot file
 fn = sys.argv[1]
 
-# Get name of the test
+# Get name of the test: with the cached Poisson operator and the extrapolated
+# initial guess (across the load balancing), the solution must match the benchmark
 test_name = os.path.split(os.getcwd())[1]
+test_name = re.sub("_cached_operator", "", test_name)
 
 # Run checksum regression test
 checksumAPI.evaluate_checksum(test_name, fn, rtol=1e-2)
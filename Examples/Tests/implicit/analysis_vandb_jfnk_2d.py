@@ -11,6 +11,7 @@
 # This simulates a 2D periodic plasma using the implicit solver
 # with the Villasenor deposition using shape factor 2.
 import os
+import re
 import sys
 
 import numpy as np
@@ -67,4 +68,7 @@ print(f"tolerance: {tolerance_rel_charge}")
 assert drho_rms < tolerance_rel_charge
 
 test_name = os.path.split(os.getcwd())[1]
+# The binned current deposition (warpx.do_binned_current_deposition)
+# gives the same results, so it is compared to the same benchmark file
+test_name = re.sub("_binned", "", test_name)
 checksumAPI.evaluate_checksum(test_name, fn)
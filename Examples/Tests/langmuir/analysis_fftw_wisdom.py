@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# The reference run (name of this test followed by "_reference") plans the FFTs
+# with FFTW_MEASURE, without the plan cache, and writes the FFTW wisdom file.
+# This test imports this wisdom and reuses the plans of the boxes of the same size:
+# the wisdom file must be complete, and the results must be the same.
+
+import os
+import sys
+
+import post_processing_utils
+
+# this will be the name of the plot file
+fn = sys.argv[1]
+
+reference_dir = os.getcwd() + "_reference"
+
+with open(os.path.join(reference_dir, "fftw_wisdom")) as f:
+    wisdom = f.read()
+print(wisdom)
+assert wisdom.startswith("(fftw-3")
+assert wisdom.rstrip().endswith(")")
+
+benchmark_fn = os.path.join(reference_dir, fn)
+post_processing_utils.check_same_fields(fn, benchmark_fn, tolerance=1e-12)
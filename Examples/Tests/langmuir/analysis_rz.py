@@ -35,8 +35,9 @@ import checksumAPI
 # this will be the name of the plot file
 fn = sys.argv[1]
 
-# test name
+# test name (the test on a single rank is compared to the benchmark of the test on several ranks)
 test_name = os.path.split(os.getcwd())[1]
+test_name = re.sub("_single_rank", "", test_name)
 
 # Parse test name and check if current correction (psatd.current_correction) is applied
 current_correction = True if re.search("current_correction", test_name) else False
@@ -18,6 +18,7 @@
 # central frequency of the Fourier transform is the expected one.
 
 import os
+import re
 import sys
 
 import matplotlib
@@ -225,7 +226,10 @@ def main():
 
     check_laser(filename_end)
 
+    # Filling all the guard cells does not change the valid data, so the
+    # safe_guard_cells version is compared to the same benchmark file
     test_name = os.path.split(os.getcwd())[1]
+    test_name = re.sub("_safe_guard_cells", "", test_name)
     checksumAPI.evaluate_checksum(test_name, filename_end)
 
 
@@ -16,6 +16,14 @@ sigmax = 516e-9
 sigmay = 7.7e-9
 Q = -3.2e-9
 
+# Get name of the test
+test_name = os.path.split(os.getcwd())[1]
+
+# The test of the cache of the IGF solver adds a second beam, with the same shape
+# and a different energy, whose field adds up to the field of the first beam
+if test_name.endswith("_igf_cache"):
+    Q += -1.6e-9
+
 
 def w(z):
     return np.exp(-(z**2)) * (1 + erf(1.0j * z))
@@ -42,8 +50,10 @@ fn = sys.argv[1]
 path = os.path.join("diags", "diag2")
 ts = OpenPMDTimeSeries(path)
 
-Ex, info = ts.get_field(field="E", coord="x", iteration=0, plot=False)
-Ey, info = ts.get_field(field="E", coord="y", iteration=0, plot=False)
+# with the cache of the IGF solver, the field after several solves
+iteration = ts.iterations[-1] if test_name.endswith("_igf_cache") else 0
+Ex, info = ts.get_field(field="E", coord="x", iteration=iteration, plot=False)
+Ey, info = ts.get_field(field="E", coord="y", iteration=iteration, plot=False)
 
 grid_x = info.x[1:-1]
 grid_y = info.y[1:-1]
@@ -64,8 +74,6 @@ for k, z in enumerate(grid_z, start=1):
     assert np.allclose(Ey_warpx, Ey_theory, rtol=0.029, atol=0)
 
 
-# Get name of the test
-test_name = os.path.split(os.getcwd())[1]
-
 # Run checksum regression test
-checksumAPI.evaluate_checksum(test_name, fn, rtol=1e-2)
+if not test_name.endswith("_igf_cache"):
+    checksumAPI.evaluate_checksum(test_name, fn, rtol=1e-2)
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+# Compare the openPMD output written by the I/O thread (openpmd_async_flush = 1)
+# with the output of the same run written synchronously (test name followed by
+# "_reference"): the fields and particles of all the steps must be identical.
+
+import os
+import sys
+
+import numpy as np
+from openpmd_viewer import OpenPMDTimeSeries
+
+# this will be the name of the openPMD output directory
+fn = sys.argv[1]
+
+ts = OpenPMDTimeSeries(fn)
+ts_ref = OpenPMDTimeSeries(os.path.join(os.getcwd() + "_reference", fn))
+
+assert np.array_equal(ts.iterations, ts_ref.iterations)
+assert len(ts.iterations) == 5
+
+for it in ts.iterations:
+    for field in ["Ex", "Ey", "Ez", "Bx", "By", "Bz", "jx", "jy", "jz"]:
+        name, coord = field[0], field[1]
+        data, _ = ts.get_field(name, coord, iteration=it)
+        data_ref, _ = ts_ref.get_field(name, coord, iteration=it)
+        print(f"iteration {it}, {field}: max |diff| = {np.max(np.abs(data - data_ref))}")
+        assert np.array_equal(data, data_ref)
+
+    for species in ["electrons", "positrons"]:
+        variables = ["z", "w", "ux", "uy", "uz"]
+        data = ts.get_particle(variables, species=species, iteration=it)
+        data_ref = ts_ref.get_particle(variables, species=species, iteration=it)
+        for var, values, values_ref in zip(variables, data, data_ref):
+            print(f"iteration {it}, {species} {var}: {values.size} particles")
+            assert values.size > 0
+            assert np.array_equal(values, values_ref)
@@ -0,0 +1 @@
+../../analysis_default_comparison.py
\ No newline at end of file
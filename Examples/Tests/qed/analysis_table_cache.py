@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+# This test runs the same simulation as the test run first
+# (name of this test, followed by "_generate"), which generates the Quantum
+# Synchrotron lookup table and writes it in the cache (qed_qs.table_cache_dir).
+# This run must load the table from the cache instead of generating it again,
+# and give the same table and the same results.
+
+import filecmp
+import glob
+import os
+import sys
+
+import post_processing_utils
+
+filename = sys.argv[1]
+
+generate_dir = os.getcwd() + "_generate"
+
+# the cache contains the table generated by the first run
+cache_files = glob.glob(os.path.join(generate_dir, "qed_table_cache", "qs_*.bin"))
+assert len(cache_files) == 1
+cache_file = cache_files[0]
+
+# the table is loaded from the cache: this run does not write it in the cache again
+assert os.path.getmtime(cache_file) < os.path.getmtime("qs_table")
+
+# the table of this run is the table generated by the first run
+assert filecmp.cmp("qs_table", cache_file, shallow=False)
+assert filecmp.cmp("qs_table", os.path.join(generate_dir, "qs_table"), shallow=False)
+
+# and the results are the same
+benchmark = os.path.join(generate_dir, filename)
+post_processing_utils.check_same_fields(filename, benchmark, tolerance=1e-12)
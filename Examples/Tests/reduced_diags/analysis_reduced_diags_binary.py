@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script tests the binary format of the reduced diagnostics.
+# Each reduced diagnostic is written both in text format and in binary format,
+# with different buffering settings (flush_steps, flush_bytes).
+# The binary files are parsed directly with numpy and compared with the text files.
+
+import numpy as np
+
+
+def read_binary(filename):
+    """
+    Read a binary reduced diagnostic: an optional header line (as in the text
+    format), followed by one record per output step, made of the step (int64),
+    the number n of values (int64) and the n values (float64).
+    """
+    with open(filename, "rb") as f:
+        content = f.read()
+
+    header = ""
+    offset = 0
+    if content[:1] == b"#":
+        offset = content.index(b"\n") + 1
+        header = content[: offset - 1].decode()
+
+    steps = []
+    rows = []
+    while offset < len(content):
+        step, n = np.frombuffer(content, dtype=np.int64, count=2, offset=offset)
+        offset += 2 * 8
+        rows.append(np.frombuffer(content, dtype=np.float64, count=n, offset=offset))
+        offset += int(n) * 8
+        steps.append(step)
+    assert offset == len(content), f"{filename}: truncated record"
+
+    return header, np.array(steps), np.array(rows)
+
+
+# Number of time steps of the simulation
+max_step = 20
+
+reduced_diags = {
+    "EP": 1,  # ParticleEnergy, written every step
+    "EF": 1,  # FieldEnergy, flushed every 7 steps
+    "NP": 3,  # ParticleNumber, flushed at the end of the simulation
+    "MF": 1,  # FieldMaximum, flushed when the buffer exceeds 256 bytes
+}
+
+for name, interval in reduced_diags.items():
+    text_file = f"./diags/reducedfiles/{name}_text.txt"
+    with open(text_file) as f:
+        header_text = f.readline().rstrip("\n")
+    data_text = np.loadtxt(text_file, ndmin=2)
+
+    header_binary, steps, data_binary = read_binary(
+        f"./diags/reducedfiles/{name}_binary.bin"
+    )
+
+    # Same header
+    assert header_binary == header_text, f"{name}: headers differ"
+
+    # All the steps are written, once and in order
+    expected_steps = np.arange(interval, max_step + 1, interval)
+    print(f"{name}: steps {steps}")
+    assert np.array_equal(steps, expected_steps), f"{name}: wrong steps"
+    assert np.array_equal(steps, data_text[:, 0]), f"{name}: steps differ"
+
+    # Same data (time and values), up to the precision of the text format
+    # (14 digits by default)
+    assert data_binary.shape == data_text[:, 1:].shape, f"{name}: shapes differ"
+    assert np.allclose(data_binary, data_text[:, 1:], rtol=1e-12, atol=0.0), (
+        f"{name}: the data differ between the binary and the text format"
+    )
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+# This script tests the deferred reductions of the reduced diagnostics.
+# The text files of the reduced diagnostics must match, line by line, the files
+# of the reference run (name of this test followed by "_reference"), in which
+# each reduced diagnostic reduces its data with blocking MPI calls.
+
+import glob
+import os
+
+import numpy as np
+
+reduced_dir = "diags/reducedfiles"
+reduced_dir_ref = os.path.join(os.getcwd() + "_reference", reduced_dir)
+
+filenames = sorted(os.path.basename(f) for f in glob.glob(f"{reduced_dir}/*.txt"))
+filenames_ref = sorted(os.path.basename(f) for f in glob.glob(f"{reduced_dir_ref}/*.txt"))
+assert filenames == filenames_ref
+assert len(filenames) > 0
+
+for filename in filenames:
+    with open(os.path.join(reduced_dir, filename)) as f:
+        header = f.readline()
+    with open(os.path.join(reduced_dir_ref, filename)) as f:
+        header_ref = f.readline()
+    assert header == header_ref, filename
+
+    data = np.loadtxt(os.path.join(reduced_dir, filename), ndmin=2)
+    data_ref = np.loadtxt(os.path.join(reduced_dir_ref, filename), ndmin=2)
+    print(f"{filename}: {data.shape[0]} lines")
+    assert data.shape == data_ref.shape, filename
+    # same steps, then same values (the reductions sum the same data in the same order)
+    assert np.array_equal(data[:, 0], data_ref[:, 0]), filename
+    assert np.allclose(data, data_ref, rtol=1e-12, atol=0.0), filename
@@ -8,7 +8,8 @@
 
 # This script tests the reduced diagnostics `LoadBalanceCosts`.
 # The setup is a uniform plasma with electrons.
-# A measure of cost (based on timers or heuristic measure from cell and particles)
+# A measure of cost (based on timers, a model fitted to the timers, or heuristic
+# measure from cell and particles)
 # diagnostic is output in the reduced diagnostic.  The efficiency (mean of cost
 # per rank, normalized to the maximum cost over all ranks) extracted from the
 # reduced diagnostic is compared before and after the load balance step; the test
@@ -78,7 +79,9 @@ print("load balance efficiency (after load balance): ", efficiency_after)
 assert efficiency_before < efficiency_after
 
 # The PICMI and native input versions run the same test, so
-# their results are compared to the same benchmark file
+# their results are compared to the same benchmark file;
+# the cost model only changes the distribution of the boxes
 test_name = os.path.split(os.getcwd())[1]
 test_name = re.sub("_picmi", "", test_name)
+test_name = re.sub("_model", "_timers", test_name)
 checksumAPI.evaluate_checksum(test_name, fn)
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script tests the incremental load balancing
+# (algo.load_balance_max_moved_boxes, algo.load_balance_max_moved_bytes).
+# The setup is a uniform plasma with electrons in a slab, so that the initial
+# distribution mapping is unbalanced. The MPI rank of each box is read from the
+# reduced diagnostic `LoadBalanceCosts`: the test ensures that boxes are moved
+# at the load balance step, that no more boxes than allowed are moved, and that
+# the efficiency improves.
+
+import numpy as np
+
+# Maximum number of boxes moved at each load balance (see inputs)
+max_moved_boxes = 2
+
+# Load costs data
+data = np.genfromtxt("./diags/reducedfiles/LBC.txt")
+data = data[:, 2:]
+
+# Compute the number of datafields saved per box
+n_data_fields = 0
+with open("./diags/reducedfiles/LBC.txt") as f:
+    h = f.readlines()[0]
+    unique_headers = ["".join([ln for ln in w if not ln.isdigit()]) for w in h.split()][
+        2::
+    ]
+    n_data_fields = len(set(unique_headers))
+
+# From data header, data layout is:
+#     [step, time,
+#      cost_box_0, proc_box_0, lev_box_0, i_low_box_0, j_low_box_0, k_low_box_0(, gpu_ID_box_0 if GPU run), hostname_box_0,
+#      ...
+#      cost_box_n, proc_box_n, lev_box_n, i_low_box_n, j_low_box_n, k_low_box_n(, gpu_ID_box_n if GPU run), hostname_box_n]
+costs = data[:, 0::n_data_fields]
+ranks = data[:, 1::n_data_fields].astype(int)
+
+
+# Function to get efficiency at an iteration i
+def get_efficiency(i):
+    rank_to_cost_map = {r: 0.0 for r in set(ranks[i])}
+    for c, r in zip(costs[i], ranks[i]):
+        rank_to_cost_map[r] += c
+    efficiencies = np.array(list(rank_to_cost_map.values()))
+    efficiencies /= efficiencies.max()
+    return efficiencies.mean()
+
+
+# Number of boxes that changed rank between consecutive iterations
+moved_boxes = np.count_nonzero(ranks[1:] != ranks[:-1], axis=1)
+print("number of moved boxes per iteration: ", moved_boxes)
+assert np.all(moved_boxes <= max_moved_boxes)
+
+# The iteration i=2 is load balanced; examine before/after load balance
+assert moved_boxes[1] > 0
+efficiency_before, efficiency_after = get_efficiency(1), get_efficiency(2)
+print("load balance efficiency (before load balance): ", efficiency_before)
+print("load balance efficiency (after load balance): ", efficiency_after)
+assert efficiency_before < efficiency_after
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+# This script tests the reduced diagnostics `PerformanceCounters`.
+# The setup is a uniform plasma with electrons, without injection or loss of particles.
+# Each output is one line of JSON: the number of particles pushed since the previous
+# output must be the number of particles (from the reduced diagnostic `ParticleNumber`)
+# times the number of steps, and the timers must be non-negative.
+
+import json
+
+import numpy as np
+
+with open("./diags/reducedfiles/PC.jsonl") as f:
+    lines = [json.loads(line) for line in f if line.strip()]
+
+# step, time, total number of macroparticles, ...
+particle_number = np.genfromtxt("./diags/reducedfiles/NP.txt", ndmin=2)
+nparticles = particle_number[0, 2]
+assert nparticles > 0
+assert np.all(particle_number[:, 2] == nparticles)
+
+assert len(lines) == 3
+previous_step = 0
+for line in lines:
+    print(line)
+    assert line["nsteps"] == line["step"] - previous_step
+    previous_step = line["step"]
+    assert line["nprocs"] == 2
+    assert line["nnodes"] >= 1
+    assert line["wall_time"] > 0.0
+
+    counters = line["counters"]
+    pushed = counters["particles_pushed/electrons"]
+    assert pushed["sum"] == nparticles * line["nsteps"]
+    assert pushed["max"] <= pushed["sum"]
+
+    deposition_time = counters["deposition_time/electrons/lev0"]
+    assert 0.0 <= deposition_time["max"] <= deposition_time["sum"]
+    assert counters.get("fillboundary_bytes_sent", {"sum": 0.0})["sum"] >= 0.0
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Compare the output of this test with the output of a reference run of the
+# same input file, where the option that this test exercises is disabled.
+# The reference run is the dependency of this test and its name is the name
+# of this test followed by "_reference". The option must not change the
+# results beyond roundoff errors.
+
+import os
+import sys
+
+import post_processing_utils
+
+# this will be the name of the plot file
+fn = sys.argv[1]
+
+# output of the reference run, with the same name
+benchmark_fn = os.path.join(os.getcwd() + "_reference", fn)
+
+post_processing_utils.check_same_fields(fn, benchmark_fn, tolerance=1e-12)
@@ -0,0 +1,78 @@
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+"""Reader for the binary output of reduced diagnostics (``<reduced_diags_name>.format = binary``).
+
+The file starts with the same header line as the text format, followed by one record
+per step: the step (int64), the number of values n (int64), then n values (float64),
+i.e., the time and the data.
+"""
+
+import numpy as np
+
+
+def read_reduced_diags_binary(filename, delimiter=" "):
+    """
+    Read binary data written by WarpX Reduced Diagnostics, and return them into Python objects,
+    like ``read_reduced_diags`` of ``Tools/PostProcessing/read_raw_data.py`` for the text format.
+
+    Parameters
+    ----------
+    filename: string
+        name of file to open
+    delimiter: string, optional
+        delimiter between fields in the header (``<reduced_diags_name>.separator``)
+
+    Returns
+    -------
+    metadata_dict: dict
+        dictionary where first key is the type of metadata, second is the field
+    data_dict: dict
+        dictionary with one array of data per field
+    """
+    with open(filename, "rb") as f:
+        content = f.read()
+
+    # Read header line
+    unformatted_header = []
+    offset = 0
+    if content[:1] == b"#":
+        offset = content.index(b"\n") + 1
+        unformatted_header = content[: offset - 1].decode().split(delimiter)
+
+    # Read records: the number of values can change from one step to the next,
+    # so shorter rows are padded with NaN
+    steps = []
+    rows = []
+    while offset < len(content):
+        step, n = np.frombuffer(content, dtype=np.int64, count=2, offset=offset)
+        offset += 2 * 8
+        rows.append(np.frombuffer(content, dtype=np.float64, count=n, offset=offset))
+        offset += int(n) * 8
+        steps.append(step)
+    ncols = max((len(row) for row in rows), default=0)
+    data = np.full((len(rows), 1 + ncols), np.nan)
+    data[:, 0] = steps
+    for i, row in enumerate(rows):
+        data[i, 1 : 1 + len(row)] = row
+
+    # From header line, get field name, units and column number
+    if not unformatted_header:
+        unformatted_header = [f"[{i}]column_{i}()" for i in range(data.shape[1])]
+    field_names = [s[s.find("]") + 1 : s.find("(")] for s in unformatted_header]
+    field_units = [s[s.find("(") + 1 : s.find(")")] for s in unformatted_header]
+    field_column = [s[s.find("[") + 1 : s.find("]")] for s in unformatted_header]
+
+    data_dict = {
+        key: data[:, i] for i, key in enumerate(field_names) if i < data.shape[1]
+    }
+    # Put header data into a dictionary
+    metadata_dict = {}
+    metadata_dict["units"] = {key: field_units[i] for i, key in enumerate(field_names)}
+    metadata_dict["column"] = {
+        key: field_column[i] for i, key in enumerate(field_names)
+    }
+    return metadata_dict, data_dict
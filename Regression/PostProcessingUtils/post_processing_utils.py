@@ -167,3 +167,38 @@ def check_random_filter(fn, filtered_fn, random_fraction, dim, species_name):
         "np.isin(ids + 0.1*cpus," "ids_filtered_warpx + 0.1*cpus_filtered_warpx)"
     )
     check_particle_filter(fn, filtered_fn, random_filter_expression, dim, species_name)
+
+
+## This function checks that all the fields and particle attributes of a plotfile are the same
+## as in a benchmark plotfile, for tests that compare two code paths that should give the same result.
+def check_same_fields(fn, benchmark_fn, tolerance):
+    ds = yt.load(fn)
+    ds_benchmark = yt.load(benchmark_fn)
+    # yt 4.0+ has rounding issues with our domain data:
+    # RuntimeError: yt attempted to read outside the boundaries
+    # of a non-periodic domain along dimension 0.
+    if "force_periodicity" in dir(ds):
+        ds.force_periodicity()
+    if "force_periodicity" in dir(ds_benchmark):
+        ds_benchmark.force_periodicity()
+    ad = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    ad_benchmark = ds_benchmark.covering_grid(
+        level=0,
+        left_edge=ds_benchmark.domain_left_edge,
+        dims=ds_benchmark.domain_dimensions,
+    )
+    print(f"\ntolerance = {tolerance}\n")
+    for field in ds_benchmark.field_list:
+        data = ad[field].squeeze().v
+        data_benchmark = ad_benchmark[field].squeeze().v
+        # particles are not necessarily written in the same order
+        if field[0] != "boxlib":
+            data = np.sort(data)
+            data_benchmark = np.sort(data_benchmark)
+        error = np.amax(np.abs(data - data_benchmark))
+        if np.amax(np.abs(data_benchmark)) != 0.0:
+            error /= np.amax(np.abs(data_benchmark))
+        print(f"field: {field}; error = {error}")
+        assert error < tolerance
@@ -0,0 +1,106 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "AsyncIOQueue.H"
+
+#include <algorithm>
+#include <utility>
+
+AsyncIOQueue::AsyncIOQueue (int max_depth):
+    m_max_depth{std::max(max_depth, 1)}
+{
+    m_thread = std::thread(&AsyncIOQueue::Run, this);
+}
+
+AsyncIOQueue::~AsyncIOQueue ()
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_task_submitted.notify_one();
+    m_thread.join();
+    // the completed tasks are released with m_done, on this thread
+}
+
+void
+AsyncIOQueue::Submit (std::function<void()> task)
+{
+    // declared before the lock, so that the completed tasks are released after unlocking
+    std::deque<std::function<void()>> done;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // back-pressure: wait for the I/O thread to catch up
+        m_task_done.wait(lock, [this] {
+            return static_cast<int>(m_tasks.size()) + (m_busy ? 1 : 0) < m_max_depth;
+        });
+        done = TakeDone();
+        RethrowError();
+        m_tasks.push_back(std::move(task));
+    }
+    m_task_submitted.notify_one();
+}
+
+void
+AsyncIOQueue::Wait ()
+{
+    // declared before the lock, so that the completed tasks are released after unlocking
+    std::deque<std::function<void()>> done;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_task_done.wait(lock, [this] { return m_tasks.empty() && !m_busy; });
+    done = TakeDone();
+    RethrowError();
+}
+
+void
+AsyncIOQueue::RethrowError ()
+{
+    if (m_error) {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+std::deque<std::function<void()>>
+AsyncIOQueue::TakeDone ()
+{
+    std::deque<std::function<void()>> done;
+    done.swap(m_done);
+    return done;
+}
+
+void
+AsyncIOQueue::Run ()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task_submitted.wait(lock, [this] { return !m_tasks.empty() || m_stop; });
+            if (m_tasks.empty()) { return; } // m_stop, and all the tasks are complete
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_busy = true;
+        }
+
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            m_busy = false;
+            // the staged data of the task is released on the main thread
+            m_done.push_back(std::move(task));
+            if (error && !m_error) { m_error = error; }
+        }
+        m_task_done.notify_all();
+    }
+}
@@ -5,6 +5,7 @@
 #   include "BoundaryConditions/PML_RZ.H"
 #endif
 #include "Diagnostics/ParticleDiag/ParticleDiag.H"
+#include "Diagnostics/ReducedDiags/MultiReducedDiags.H"
 #include "FieldSolver/Fields.H"
 #include "Particles/WarpXParticleContainer.H"
 #include "Utils/TextMsg.H"
@@ -47,6 +48,10 @@ FlushFormatCheckpoint::WriteToFile (
 
     auto & warpx = WarpX::GetInstance();
 
+    // Write the output of the reduced diags up to this step, so that it is
+    // consistent with the checkpoint when restarting
+    if (warpx.reduced_diags->m_plot_rd != 0) { warpx.reduced_diags->Flush(); }
+
     const VisMF::Header::Version current_version = VisMF::GetHeaderVersion();
     VisMF::SetHeaderVersion(amrex::VisMF::Header::NoFabHeader_v1);
 
@@ -104,13 +104,30 @@ FlushFormatOpenPMD::FlushFormatOpenPMD (const std::string& diag_name)
         engine_parameters.insert({k, v});
     }
 
+    // write the data to disk in a dedicated I/O thread, while the simulation continues
+    bool openpmd_async_flush = false;
+    pp_diag_name.query("openpmd_async_flush", openpmd_async_flush);
+    int openpmd_async_queue_depth = 1;
+    pp_diag_name.query("openpmd_async_queue_depth", openpmd_async_queue_depth);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(openpmd_async_queue_depth > 0,
+        diag_name + ".openpmd_async_queue_depth must be positive");
+    if (openpmd_async_flush && diag_type_str != "Full") {
+        // BTD and boundary scraping diagnostics write multiple times to the same iteration
+        const std::string warnMsg = diag_name + " Unable to support openpmd_async_flush with "
+            + diag_type_str + " diagnostics. Using synchronous output.";
+        ablastr::warn_manager::WMRecordWarning("Diagnostics", warnMsg);
+        openpmd_async_flush = false;
+    }
+
     auto & warpx = WarpX::GetInstance();
     m_OpenPMDPlotWriter = std::make_unique<WarpXOpenPMDPlot>(
         encoding, openpmd_backend,
         operator_type, operator_parameters,
         engine_type, engine_parameters,
         warpx.getPMLdirections(),
-        warpx.GetAuthors()
+        warpx.GetAuthors(),
+        openpmd_async_flush,
+        openpmd_async_queue_depth
     );
 }
 
@@ -208,10 +208,10 @@ void ChargeOnEB::ComputeDiags (const int step)
     // Reduce across MPI ranks
     surface_integral.copyToHost();
     amrex::Real surface_integral_value = *(surface_integral.hostData());
-    amrex::ParallelDescriptor::ReduceRealSum( surface_integral_value );
 
     // save data
     m_data[0] = PhysConst::ep0 * surface_integral_value;
+    ReduceRealSum(m_data.data(), 1);
 #endif
 }
 // end void ChargeOnEB::ComputeDiags
@@ -0,0 +1,94 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "DeferredReductions.H"
+
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXProfilerWrapper.H"
+
+#include <AMReX_ParallelDescriptor.H>
+
+#include <algorithm>
+#include <utility>
+
+void DeferredReductions::Add (Op op, amrex::Real* data, int n)
+{
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_started,
+        "DeferredReductions: values cannot be added while the reductions are in progress");
+    if (n > 0) {
+        m_entries[static_cast<int>(op)].push_back(Entry{data, n});
+    }
+}
+
+void DeferredReductions::AddCallback (std::function<void()> f)
+{
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_started,
+        "DeferredReductions: functions cannot be added while the reductions are in progress");
+    m_callbacks.push_back(std::move(f));
+}
+
+void DeferredReductions::Start ()
+{
+    WARPX_PROFILE("DeferredReductions::Start()");
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_started,
+        "DeferredReductions: Start was called twice without Finish");
+    m_started = true;
+
+    for (int i_op = 0; i_op < n_ops; ++i_op)
+    {
+        // pack the values of all the reduced diagnostics
+        auto& buffer = m_buffers[i_op];
+        buffer.clear();
+        for (auto const& entry : m_entries[i_op]) {
+            buffer.insert(buffer.end(), entry.data, entry.data + entry.n);
+        }
+
+#ifdef AMREX_USE_MPI
+        m_requests[i_op] = MPI_REQUEST_NULL;
+        if (buffer.empty()) { continue; }
+
+        MPI_Op mpi_op = MPI_SUM;
+        if (i_op == static_cast<int>(Op::Max)) { mpi_op = MPI_MAX; }
+        if (i_op == static_cast<int>(Op::Min)) { mpi_op = MPI_MIN; }
+
+        BL_MPI_REQUIRE( MPI_Iallreduce(MPI_IN_PLACE, buffer.data(), static_cast<int>(buffer.size()),
+                                       amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(),
+                                       mpi_op, amrex::ParallelDescriptor::Communicator(),
+                                       &m_requests[i_op]) );
+#endif
+    }
+}
+
+void DeferredReductions::Finish ()
+{
+    WARPX_PROFILE("DeferredReductions::Finish()");
+
+    if (!m_started) { return; }
+
+#ifdef AMREX_USE_MPI
+    BL_MPI_REQUIRE( MPI_Waitall(n_ops, m_requests.data(), MPI_STATUSES_IGNORE) );
+#endif
+
+    // unpack the reduced values
+    for (int i_op = 0; i_op < n_ops; ++i_op)
+    {
+        auto const* value = m_buffers[i_op].data();
+        for (auto const& entry : m_entries[i_op]) {
+            std::copy(value, value + entry.n, entry.data);
+            value += entry.n;
+        }
+        m_entries[i_op].clear();
+    }
+
+    // Reset before calling the functions, so that they can register new reductions
+    auto callbacks = std::move(m_callbacks);
+    m_callbacks.clear();
+    m_started = false;
+
+    for (auto const& f : callbacks) { f(); }
+}
@@ -264,8 +264,7 @@ void DifferentialLuminosity::ComputeDiags (int step)
             d_data.begin(), d_data.end(), m_data.begin());
 
         // reduced sum over mpi ranks
-        ParallelDescriptor::ReduceRealSum
-            (m_data.data(), static_cast<int>(m_data.size()), ParallelDescriptor::IOProcessorNumber());
+        ReduceRealSum(m_data.data(), static_cast<int>(m_data.size()), ParallelDescriptor::IOProcessorNumber());
     }
 
 #endif // not RZ
@@ -116,16 +116,16 @@ void FieldEnergy::ComputeDiags (int step)
         Geometry const & geom = warpx.Geom(lev);
 
         // compute E squared
-        Real const tmpEx = Ex.norm2(0,geom.periodicity());
-        Real const tmpEy = Ey.norm2(0,geom.periodicity());
-        Real const tmpEz = Ez.norm2(0,geom.periodicity());
-        Real const Es = tmpEx*tmpEx + tmpEy*tmpEy + tmpEz*tmpEz;
+        Real const tmpEx = ComputeNorm2(Ex, geom.periodicity());
+        Real const tmpEy = ComputeNorm2(Ey, geom.periodicity());
+        Real const tmpEz = ComputeNorm2(Ez, geom.periodicity());
+        Real const Es = tmpEx + tmpEy + tmpEz;
 
         // compute B squared
-        Real const tmpBx = Bx.norm2(0,geom.periodicity());
-        Real const tmpBy = By.norm2(0,geom.periodicity());
-        Real const tmpBz = Bz.norm2(0,geom.periodicity());
-        Real const Bs = tmpBx*tmpBx + tmpBy*tmpBy + tmpBz*tmpBz;
+        Real const tmpBx = ComputeNorm2(Bx, geom.periodicity());
+        Real const tmpBy = ComputeNorm2(By, geom.periodicity());
+        Real const tmpBz = ComputeNorm2(Bz, geom.periodicity());
+        Real const Bs = tmpBx + tmpBy + tmpBz;
 #endif
 
         constexpr int noutputs = 3; // total energy, E-field energy and B-field energy
@@ -133,7 +133,7 @@ void FieldEnergy::ComputeDiags (int step)
         constexpr int index_E = 1;
         constexpr int index_B = 2;
 
-        // save data
+        // save the local data, which is summed over MPI ranks below
         m_data[lev*noutputs+index_E] = 0.5_rt * Es * PhysConst::ep0 * dV;
         m_data[lev*noutputs+index_B] = 0.5_rt * Bs / PhysConst::mu0 * dV;
         m_data[lev*noutputs+index_total] = m_data[lev*noutputs+index_E] +
@@ -141,6 +141,9 @@ void FieldEnergy::ComputeDiags (int step)
     }
     // end loop over refinement levels
 
+    // Reduced sum over MPI ranks
+    ReduceRealSum(m_data.data(), static_cast<int>(m_data.size()));
+
     /* m_data now contains up-to-date values for:
      *  [total field energy at level 0,
      *   electric field energy at level 0,
@@ -152,7 +155,38 @@ void FieldEnergy::ComputeDiags (int step)
 }
 // end void FieldEnergy::ComputeDiags
 
-// Function that computes the sum of the field squared in RZ
+// Function that computes the local sum of the field squared
+amrex::Real
+FieldEnergy::ComputeNorm2 (const amrex::MultiFab& field, const amrex::Periodicity& period)
+{
+    // Number of boxes that contain each point, so that the points shared
+    // by several boxes (e.g. nodal points) are only counted once
+    const auto mask = field.OverlapMask(period);
+
+    amrex::ReduceOps<amrex::ReduceOpSum> reduce_ops;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_ops);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for ( amrex::MFIter mfi(field, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi )
+    {
+        amrex::Array4<const amrex::Real> const& field_arr = field.const_array(mfi);
+        amrex::Array4<const amrex::Real> const& mask_arr = mask->const_array(mfi);
+
+        reduce_ops.eval(mfi.tilebox(), reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return field_arr(i,j,k)*field_arr(i,j,k)/mask_arr(i,j,k);
+            });
+    }
+
+    return amrex::get<0>(reduce_data.value());
+}
+// end Real FieldEnergy::ComputeNorm2
+
+// Function that computes the local sum of the field squared in RZ
 amrex::Real
 FieldEnergy::ComputeNorm2RZ(const amrex::MultiFab& field, const int lev)
 {
@@ -209,28 +209,25 @@ void FieldMaximum::ComputeDiags (int step)
         }
 
         auto hv = reduce_data.value();
-        Real hv_Ex = amrex::get<0>(hv); // highest value of |Ex|
-        Real hv_Ey = amrex::get<1>(hv); // highest value of |Ey|
-        Real hv_Ez = amrex::get<2>(hv); // highest value of |Ez|
-        Real hv_Bx = amrex::get<3>(hv); // highest value of |Bx|
-        Real hv_By = amrex::get<4>(hv); // highest value of |By|
-        Real hv_Bz = amrex::get<5>(hv); // highest value of |Bz|
-        Real hv_E  = amrex::get<6>(hv); // highest value of |E|**2
-        Real hv_B  = amrex::get<7>(hv); // highest value of |B|**2
+
+        // Fill output array with the local values, which are reduced over MPI ranks
+        // (|E| and |B| are squared until the reduction is complete)
+        m_data[lev*noutputs+index_Ex] = amrex::get<0>(hv); // highest value of |Ex|
+        m_data[lev*noutputs+index_Ey] = amrex::get<1>(hv); // highest value of |Ey|
+        m_data[lev*noutputs+index_Ez] = amrex::get<2>(hv); // highest value of |Ez|
+        m_data[lev*noutputs+index_Bx] = amrex::get<3>(hv); // highest value of |Bx|
+        m_data[lev*noutputs+index_By] = amrex::get<4>(hv); // highest value of |By|
+        m_data[lev*noutputs+index_Bz] = amrex::get<5>(hv); // highest value of |Bz|
+        m_data[lev*noutputs+index_absE] = amrex::get<6>(hv); // highest value of |E|**2
+        m_data[lev*noutputs+index_absB] = amrex::get<7>(hv); // highest value of |B|**2
 
         // MPI reduce
-        ParallelDescriptor::ReduceRealMax({hv_Ex,hv_Ey,hv_Ez,
-                                           hv_Bx,hv_By,hv_Bz, hv_E, hv_B});
-
-        // Fill output array
-        m_data[lev*noutputs+index_Ex] = hv_Ex;
-        m_data[lev*noutputs+index_Ey] = hv_Ey;
-        m_data[lev*noutputs+index_Ez] = hv_Ez;
-        m_data[lev*noutputs+index_Bx] = hv_Bx;
-        m_data[lev*noutputs+index_By] = hv_By;
-        m_data[lev*noutputs+index_Bz] = hv_Bz;
-        m_data[lev*noutputs+index_absE] = std::sqrt(hv_E);
-        m_data[lev*noutputs+index_absB] = std::sqrt(hv_B);
+        ReduceRealMax(m_data.data() + lev*noutputs, noutputs);
+
+        AfterReductions([this, lev] () {
+            m_data[lev*noutputs+index_absE] = std::sqrt(m_data[lev*noutputs+index_absE]);
+            m_data[lev*noutputs+index_absB] = std::sqrt(m_data[lev*noutputs+index_absB]);
+        });
     }
     // end loop over refinement levels
 
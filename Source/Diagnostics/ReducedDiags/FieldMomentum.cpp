@@ -176,21 +176,23 @@ void FieldMomentum::ComputeDiags (int step)
                 });
         }
 
-        // MPI reduce
         auto r = reduce_data.value();
-        amrex::Real ExB_x = amrex::get<0>(r);
-        amrex::Real ExB_y = amrex::get<1>(r);
-        amrex::Real ExB_z = amrex::get<2>(r);
-        amrex::ParallelDescriptor::ReduceRealSum({ExB_x,ExB_y,ExB_z});
+        const amrex::Real ExB_x = amrex::get<0>(r);
+        const amrex::Real ExB_y = amrex::get<1>(r);
+        const amrex::Real ExB_z = amrex::get<2>(r);
 
         // Get cell volume
         const std::array<Real, 3> &dx = WarpX::CellSize(lev);
         const amrex::Real dV = dx[0]*dx[1]*dx[2];
 
-        // Save data (offset: 3 values for each refinement level)
+        // Save local data (offset: 3 values for each refinement level),
+        // which is summed over MPI ranks below
         const int offset = lev*3;
         m_data[offset+0] = PhysConst::ep0 * ExB_x * dV;
         m_data[offset+1] = PhysConst::ep0 * ExB_y * dV;
         m_data[offset+2] = PhysConst::ep0 * ExB_z * dV;
     }
+
+    // MPI reduce
+    ReduceRealSum(m_data.data(), static_cast<int>(m_data.size()));
 }
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -52,6 +53,8 @@ using namespace warpx::fields;
 FieldProbe::FieldProbe (const std::string& rd_name)
 : ReducedDiags{rd_name}, m_probe(&WarpX::GetInstance())
 {
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_format == "text",
+        "FieldProbe reduced diagnostics only support the text format");
 
     // read number of levels
     int nLevel = 0;
@@ -630,7 +633,7 @@ void FieldProbe::ComputeDiags (int step)
     m_last_compute_step = step;
 } // end void FieldProbe::ComputeDiags
 
-void FieldProbe::WriteToFile (int step) const
+void FieldProbe::WriteToFile (int step)
 {
     if (!(ProbeInDomain() && amrex::ParallelDescriptor::IOProcessor())) { return; }
 
@@ -658,9 +661,7 @@ void FieldProbe::WriteToFile (int step) const
         }
     }
 
-    // open file
-    std::ofstream ofs{m_path + m_rd_name + "." + m_extension,
-                        std::ofstream::out | std::ofstream::app};
+    std::ostringstream ofs;
 
     // loop over num valid particles and write
     for (long int i = 0; i < m_valid_particles; i++)
@@ -670,7 +671,7 @@ void FieldProbe::WriteToFile (int step) const
         ofs << m_sep;
         ofs << std::fixed << std::setprecision(14) << std::scientific;
         // write time
-        ofs << WarpX::GetInstance().gett_new(0);
+        ofs << m_time;
 
         // start at k = 1 since the particle id is not written to file
         for (int k = 1; k < noutputs; k++)
@@ -680,6 +681,6 @@ void FieldProbe::WriteToFile (int step) const
         }
         ofs << "\n";
     } // end loop over data size
-    // close file
-    ofs.close();
+
+    WriteBuffered(ofs.str());
 }
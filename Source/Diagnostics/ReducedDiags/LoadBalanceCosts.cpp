@@ -32,6 +32,7 @@
 #include <iomanip>
 #include <istream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -70,6 +71,8 @@ namespace
 LoadBalanceCosts::LoadBalanceCosts (const std::string& rd_name)
     : ReducedDiags{rd_name}
 {
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_format == "text",
+        "LoadBalanceCosts reduced diagnostics only support the text format");
 }
 
 // function that gathers costs
@@ -244,11 +247,9 @@ void LoadBalanceCosts::ComputeDiags (int step)
 }
 
 // write to file function for cost
-void LoadBalanceCosts::WriteToFile (int step) const
+void LoadBalanceCosts::WriteToFile (int step)
 {
-    // open file
-    std::ofstream ofs{m_path + m_rd_name + "." + m_extension,
-            std::ofstream::out | std::ofstream::app};
+    std::ostringstream ofs;
 
     // write step
     ofs << step+1 << m_sep;
@@ -257,7 +258,7 @@ void LoadBalanceCosts::WriteToFile (int step) const
     ofs << std::fixed << std::setprecision(14) << std::scientific;
 
     // write time
-    ofs << WarpX::GetInstance().gett_new(0);
+    ofs << m_time;
 
     // loop over data size and write
     for (int i = 0; i < static_cast<int>(m_data.size()); ++i)
@@ -277,8 +278,7 @@ void LoadBalanceCosts::WriteToFile (int step) const
     // end line
     ofs << "\n";
 
-    // close file
-    ofs.close();
+    WriteBuffered(ofs.str());
 
     // get a reference to WarpX instance
     auto& warpx = WarpX::GetInstance();
@@ -288,6 +288,9 @@ void LoadBalanceCosts::WriteToFile (int step) const
     // final step is a special case, fill jagged array with NaN
     if (m_intervals.nextContains(step+1) > warpx.maxStep())
     {
+        // the data-containing file is read below
+        FlushToFile();
+
         // open tmp file to copy data
         const std::string fileTmpName = m_path + m_rd_name + ".tmp." + m_extension;
         std::ofstream ofstmp(fileTmpName, std::ofstream::out);
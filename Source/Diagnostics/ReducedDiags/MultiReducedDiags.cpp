@@ -23,9 +23,11 @@
 #include "ParticleHistogram2D.H"
 #include "ParticleMomentum.H"
 #include "ParticleNumber.H"
+#include "PerformanceCounters.H"
 #include "RhoMaximum.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXProfilerWrapper.H"
+#include "WarpX.H"
 
 #include <AMReX.H>
 #include <AMReX_ParallelDescriptor.H>
@@ -49,6 +51,9 @@ MultiReducedDiags::MultiReducedDiags ()
     // if names are not given, reduced diags will not be done
     if ( m_plot_rd == 0 ) { return; }
 
+    // aggregate the MPI reductions of all reduced diags
+    pp_warpx.query("reduced_diags_deferred_reductions", m_defer_reductions);
+
     using CS = const std::string& ;
     const auto reduced_diags_dictionary =
         std::map<std::string, std::function<std::unique_ptr<ReducedDiags>(CS)>>{
@@ -69,6 +74,7 @@ MultiReducedDiags::MultiReducedDiags ()
             {"ParticleHistogram2D",   [](CS s){return std::make_unique<ParticleHistogram2D>(s);}},
             {"ParticleNumber",        [](CS s){return std::make_unique<ParticleNumber>(s);}},
             {"ParticleExtrema",       [](CS s){return std::make_unique<ParticleExtrema>(s);}},
+            {"PerformanceCounters",   [](CS s){return std::make_unique<PerformanceCounters>(s);}},
             {"ChargeOnEB",  [](CS s){return std::make_unique<ChargeOnEB>(s);}}
     };
     // loop over all reduced diags and fill m_multi_rd with requested reduced diags
@@ -88,6 +94,10 @@ MultiReducedDiags::MultiReducedDiags ()
             return reduced_diags_dictionary.at(rd_type)(rd_name);
         });
     // end loop over all reduced diags
+
+    if (m_defer_reductions) {
+        for (auto& rd : m_multi_rd) { rd->m_deferred_reductions = &m_deferred_reductions; }
+    }
 }
 // end constructor
 
@@ -113,17 +123,58 @@ void MultiReducedDiags::ComputeDiags (int step)
 {
     WARPX_PROFILE("MultiReducedDiags::ComputeDiags()");
 
+    // complete the reductions of the previous step, before m_data is overwritten
+    FinishDeferredReductions();
+
+    const amrex::Real time = WarpX::GetInstance().gett_new(0);
+
     // loop over all reduced diags
     for (int i_rd = 0; i_rd < static_cast<int>(m_rd_names.size()); ++i_rd)
     {
+        m_multi_rd[i_rd] -> m_time = time;
         m_multi_rd[i_rd] -> ComputeDiags(step);
     }
     // end loop over all reduced diags
+
+    // start the reductions of all reduced diags at once: they are completed
+    // at the next call, and overlap with the next step in the meantime
+    if (m_defer_reductions) {
+        m_deferred_reductions.Start();
+        m_deferred_step = step;
+    }
 }
 // end void MultiReducedDiags::ComputeDiags
 
 // function to write data
 void MultiReducedDiags::WriteToFile (int step)
+{
+    // With deferred reductions, the data is written once the reductions are complete
+    if (m_defer_reductions) { return; }
+
+    WriteAllToFile(step);
+}
+// end void MultiReducedDiags::WriteToFile
+
+void MultiReducedDiags::FinishDeferredReductions ()
+{
+    if (m_deferred_step < 0) { return; }
+
+    m_deferred_reductions.Finish();
+    WriteAllToFile(m_deferred_step);
+    m_deferred_step = -1;
+}
+
+void MultiReducedDiags::Flush ()
+{
+    FinishDeferredReductions();
+
+    // Only the I/O rank buffers output
+    if ( !ParallelDescriptor::IOProcessor() ) { return; }
+
+    for (auto& rd : m_multi_rd) { rd->FlushToFile(); }
+}
+
+void MultiReducedDiags::WriteAllToFile (int step)
 {
     // Only the I/O rank does
     if ( !ParallelDescriptor::IOProcessor() ) { return; }
@@ -139,4 +190,3 @@ void MultiReducedDiags::WriteToFile (int step)
     }
     // end loop over all reduced diags
 }
-// end void MultiReducedDiags::WriteToFile
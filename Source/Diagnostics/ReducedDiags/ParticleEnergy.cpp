@@ -96,7 +96,7 @@ void ParticleEnergy::ComputeDiags (int step)
     // Get number of species
     const int nSpecies = mypc.nSpecies();
 
-    amrex::Real Wtot = 0.0_rt;
+    m_sum_weights.resize(nSpecies);
 
     // Loop over species
     for (int i_s = 0; i_s < nSpecies; ++i_s)
@@ -152,61 +152,77 @@ void ParticleEnergy::ComputeDiags (int step)
             Ws   = amrex::get<1>(r);
         }
 
-        // Reduced sum over MPI ranks
-        ParallelDescriptor::ReduceRealSum({Etot,Ws}, ParallelDescriptor::IOProcessorNumber());
-
-        // Accumulate sum of weights over all species (must come after MPI reduction of Ws)
-        Wtot += Ws;
-
-        // Save results for this species i_s into m_data
+        // Save the local results for this species i_s into m_data, and the local
+        // sum of weights into m_sum_weights: they are summed over MPI ranks below
 
         // Offset:
         // 1 value of total energy for all  species +
         // 1 value of total energy for each species
         const int offset_total_species = 1 + i_s;
         m_data[offset_total_species] = Etot;
+        m_sum_weights[i_s] = Ws;
+    }
 
-        // Offset:
-        // 1 value of total energy for all  species +
-        // 1 value of total energy for each species +
-        // 1 value of mean  energy for all  species +
-        // 1 value of mean  energy for each species
-        const int offset_mean_species = 1 + nSpecies + 1 + i_s;
-        if (Ws > std::numeric_limits<Real>::min())
+    // Reduced sum over MPI ranks
+    ReduceRealSum(m_data.data() + 1, nSpecies, ParallelDescriptor::IOProcessorNumber());
+    ReduceRealSum(m_sum_weights.data(), nSpecies, ParallelDescriptor::IOProcessorNumber());
+
+    // The mean and total energies are computed once the sums are complete
+    AfterReductions([this, nSpecies] ()
+    {
+        amrex::Real Wtot = 0.0_rt;
+
+        // Loop over species
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
         {
-            m_data[offset_mean_species] = Etot / Ws;
+            const amrex::Real Etot = m_data[1 + i_s];
+            const amrex::Real Ws = m_sum_weights[i_s];
+
+            // Accumulate sum of weights over all species
+            Wtot += Ws;
+
+            // Offset:
+            // 1 value of total energy for all  species +
+            // 1 value of total energy for each species +
+            // 1 value of mean  energy for all  species +
+            // 1 value of mean  energy for each species
+            const int offset_mean_species = 1 + nSpecies + 1 + i_s;
+            if (Ws > std::numeric_limits<Real>::min())
+            {
+                m_data[offset_mean_species] = Etot / Ws;
+            }
+            else
+            {
+                m_data[offset_mean_species] = 0.0_rt;
+            }
         }
-        else
+
+        // Total energy
+        m_data[0] = 0.0_rt;
+
+        // Loop over species
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
         {
-            m_data[offset_mean_species] = 0.0_rt;
+            // Offset:
+            // 1 value of total energy for all  species +
+            // 1 value of total energy for each species
+            const int offset_total_species = 1 + i_s;
+            m_data[0] += m_data[offset_total_species];
         }
-    }
-
-    // Total energy
-    m_data[0] = 0.0_rt;
 
-    // Loop over species
-    for (int i_s = 0; i_s < nSpecies; ++i_s)
-    {
-        // Offset:
+        // Total mean energy. Offset:
         // 1 value of total energy for all  species +
         // 1 value of total energy for each species
-        const int offset_total_species = 1 + i_s;
-        m_data[0] += m_data[offset_total_species];
-    }
-
-    // Total mean energy. Offset:
-    // 1 value of total energy for all  species +
-    // 1 value of total energy for each species
-    const int offset_mean_all = 1 + nSpecies;
-    if (Wtot > std::numeric_limits<Real>::min())
-    {
-        m_data[offset_mean_all] = m_data[0] / Wtot;
-    }
-    else
-    {
-        m_data[offset_mean_all] = 0.0_rt;
-    }
+        const int offset_mean_all = 1 + nSpecies;
+        if (Wtot > std::numeric_limits<Real>::min())
+        {
+            m_data[offset_mean_all] = m_data[0] / Wtot;
+        }
+        else
+        {
+            m_data[offset_mean_all] = 0.0_rt;
+        }
+    });
 
     // m_data now contains up-to-date values for:
     // [total energy (all species)
@@ -202,14 +202,14 @@ void ParticleExtrema::ComputeDiags (int step)
             },
             reduce_ops);
 
-        amrex::Real wmin = amrex::get<0>(posminmax);
-        amrex::Real xmin = amrex::get<1>(posminmax);
-        amrex::Real ymin = amrex::get<2>(posminmax);
-        amrex::Real zmin = amrex::get<3>(posminmax);
-        amrex::Real wmax = amrex::get<4>(posminmax);
-        amrex::Real xmax = amrex::get<5>(posminmax);
-        amrex::Real ymax = amrex::get<6>(posminmax);
-        amrex::Real zmax = amrex::get<7>(posminmax);
+        const amrex::Real wmin = amrex::get<0>(posminmax);
+        const amrex::Real xmin = amrex::get<1>(posminmax);
+        const amrex::Real ymin = amrex::get<2>(posminmax);
+        const amrex::Real zmin = amrex::get<3>(posminmax);
+        const amrex::Real wmax = amrex::get<4>(posminmax);
+        const amrex::Real xmax = amrex::get<5>(posminmax);
+        const amrex::Real ymax = amrex::get<6>(posminmax);
+        const amrex::Real zmax = amrex::get<7>(posminmax);
 
         amrex::Real const gfactor = (is_photon ? 0._rt : 1._rt);
         auto uminmax = amrex::ParticleReduce<amrex::ReduceData<amrex::Real, amrex::Real, amrex::Real, amrex::Real,
@@ -226,25 +226,28 @@ void ParticleExtrema::ComputeDiags (int step)
             },
             reduce_ops);
 
-        amrex::Real gmin = amrex::get<0>(uminmax);
-        amrex::Real uxmin = amrex::get<1>(uminmax);
-        amrex::Real uymin = amrex::get<2>(uminmax);
-        amrex::Real uzmin = amrex::get<3>(uminmax);
-        amrex::Real gmax = amrex::get<4>(uminmax);
-        amrex::Real uxmax = amrex::get<5>(uminmax);
-        amrex::Real uymax = amrex::get<6>(uminmax);
-        amrex::Real uzmax = amrex::get<7>(uminmax);
-
-        amrex::ParallelDescriptor::ReduceRealMin({xmin,ymin,zmin,uxmin,uymin,uzmin,gmin,wmin});
-        amrex::ParallelDescriptor::ReduceRealMax({xmax,ymax,zmax,uxmax,uymax,uzmax,gmax,wmax});
+        const amrex::Real gmin = amrex::get<0>(uminmax);
+        const amrex::Real uxmin = amrex::get<1>(uminmax);
+        const amrex::Real uymin = amrex::get<2>(uminmax);
+        const amrex::Real uzmin = amrex::get<3>(uminmax);
+        const amrex::Real gmax = amrex::get<4>(uminmax);
+        const amrex::Real uxmax = amrex::get<5>(uminmax);
+        const amrex::Real uymax = amrex::get<6>(uminmax);
+        const amrex::Real uzmax = amrex::get<7>(uminmax);
+
+        // MPI reduce
+        m_min_values = {xmin,ymin,zmin,uxmin,uymin,uzmin,gmin,wmin};
+        m_max_values = {xmax,ymax,zmax,uxmax,uymax,uzmax,gmax,wmax};
+        ReduceRealMin(m_min_values.data(), static_cast<int>(m_min_values.size()));
+        ReduceRealMax(m_max_values.data(), static_cast<int>(m_max_values.size()));
 
 #if (defined WARPX_QED)
         // get number of level (int)
         const auto level_number = WarpX::GetInstance().finestLevel();
 
         // compute chimin and chimax
-        amrex::Real chimin_f = 0.0_rt;
-        amrex::Real chimax_f = 0.0_rt;
+        m_chimin = 0.0_rt;
+        m_chimax = 0.0_rt;
 
         if (myspc.DoQED())
         {
@@ -354,40 +357,43 @@ void ParticleExtrema::ComputeDiags (int step)
                 chimin[lev] = amrex::get<0>(val);
                 chimax[lev] = amrex::get<1>(val);
             }
-            chimin_f = *std::min_element(chimin.begin(), chimin.end());
-            chimax_f = *std::max_element(chimax.begin(), chimax.end());
-            amrex::ParallelDescriptor::ReduceRealMin(chimin_f, amrex::ParallelDescriptor::IOProcessorNumber());
-            amrex::ParallelDescriptor::ReduceRealMax(chimax_f, amrex::ParallelDescriptor::IOProcessorNumber());
+            m_chimin = *std::min_element(chimin.begin(), chimin.end());
+            m_chimax = *std::max_element(chimax.begin(), chimax.end());
+            ReduceRealMin(&m_chimin, 1, amrex::ParallelDescriptor::IOProcessorNumber());
+            ReduceRealMax(&m_chimax, 1, amrex::ParallelDescriptor::IOProcessorNumber());
         }
 #endif
 
-        const auto get_idx = [&](const std::string& name){
-            return m_headers_indices.at(name).idx;
-        };
-
-        m_data[get_idx("xmin")]  = xmin;
-        m_data[get_idx("xmax")]  = xmax;
-        m_data[get_idx("ymin")]  = ymin;
-        m_data[get_idx("ymax")]  = ymax;
-        m_data[get_idx("zmin")]  = zmin;
-        m_data[get_idx("zmax")]  = zmax;
-        m_data[get_idx("pxmin")]  = uxmin*m;
-        m_data[get_idx("pxmax")]  = uxmax*m;
-        m_data[get_idx("pymin")]  = uymin*m;
-        m_data[get_idx("pymax")]  = uymax*m;
-        m_data[get_idx("pzmin")] = uzmin*m;
-        m_data[get_idx("pzmax")] = uzmax*m;
-        m_data[get_idx("gmin")] = gmin;
-        m_data[get_idx("gmax")] = gmax;
-        m_data[get_idx("wmin")] = wmin;
-        m_data[get_idx("wmax")] = wmax;
-#if (defined WARPX_QED)
-        if (myspc.DoQED())
+        // Fill output array once the reductions are complete
+        AfterReductions([this, m] ()
         {
-            m_data[get_idx("chimin")] = chimin_f;
-            m_data[get_idx("chimax")] = chimax_f;
-        }
-#endif
+            const auto get_idx = [&](const std::string& name){
+                return m_headers_indices.at(name).idx;
+            };
+
+            m_data[get_idx("xmin")]  = m_min_values[0];
+            m_data[get_idx("xmax")]  = m_max_values[0];
+            m_data[get_idx("ymin")]  = m_min_values[1];
+            m_data[get_idx("ymax")]  = m_max_values[1];
+            m_data[get_idx("zmin")]  = m_min_values[2];
+            m_data[get_idx("zmax")]  = m_max_values[2];
+            m_data[get_idx("pxmin")]  = m_min_values[3]*m;
+            m_data[get_idx("pxmax")]  = m_max_values[3]*m;
+            m_data[get_idx("pymin")]  = m_min_values[4]*m;
+            m_data[get_idx("pymax")]  = m_max_values[4]*m;
+            m_data[get_idx("pzmin")] = m_min_values[5]*m;
+            m_data[get_idx("pzmax")] = m_max_values[5]*m;
+            m_data[get_idx("gmin")] = m_min_values[6];
+            m_data[get_idx("gmax")] = m_max_values[6];
+            m_data[get_idx("wmin")] = m_min_values[7];
+            m_data[get_idx("wmax")] = m_max_values[7];
+            // chi is only computed for species with QED
+            if (m_headers_indices.count("chimin") > 0)
+            {
+                m_data[get_idx("chimin")] = m_chimin;
+                m_data[get_idx("chimax")] = m_chimax;
+            }
+        });
     }
     // end loop over species
 }
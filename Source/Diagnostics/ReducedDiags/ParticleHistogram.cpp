@@ -253,9 +253,16 @@ void ParticleHistogram::ComputeDiags (int step)
         d_data.begin(), d_data.end(), m_data.begin());
 
     // reduced sum over mpi ranks
-    ParallelDescriptor::ReduceRealSum
+    ReduceRealSum
         (m_data.data(), static_cast<int>(m_data.size()), ParallelDescriptor::IOProcessorNumber());
 
+    // the histogram is normalized once the sum is complete
+    AfterReductions([this] () { Normalize(); });
+}
+// end void ParticleHistogram::ComputeDiags
+
+void ParticleHistogram::Normalize ()
+{
     // normalize the maximum value to be one
     if ( m_norm == NormalizationType::max_to_unity )
     {
@@ -286,4 +293,4 @@ void ParticleHistogram::ComputeDiags (int step)
         return;
     }
 }
-// end void ParticleHistogram::ComputeDiags
+// end void ParticleHistogram::Normalize
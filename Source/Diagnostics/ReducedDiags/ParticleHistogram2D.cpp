@@ -247,15 +247,14 @@ void ParticleHistogram2D::ComputeDiags (int step)
 
     // reduced sum over mpi ranks
     const int size = static_cast<int> (d_data_2D.size());
-    ParallelDescriptor::ReduceRealSum
-            (h_table_data.p, size, ParallelDescriptor::IOProcessorNumber());
+    ReduceRealSum(h_table_data.p, size, ParallelDescriptor::IOProcessorNumber());
 
     // Return for all that are not IO processor
     if ( !ParallelDescriptor::IOProcessor() ) { return; }
 }
 // end void ParticleHistogram2D::ComputeDiags
 
-void ParticleHistogram2D::WriteToFile (int step) const
+void ParticleHistogram2D::WriteToFile (int step)
 {
 #ifdef WARPX_USE_OPENPMD
     // only IO processor writes
@@ -304,10 +303,8 @@ void ParticleHistogram2D::WriteToFile (int step) const
 
     // UNIT DIMENSION IS NOT SET ON THE VALUES
 
-    // Get time at level 0
-    auto & warpx = WarpX::GetInstance();
-    auto const time = warpx.gett_new(0);
-    i.setTime(time);
+    // Time at level 0, when the histogram was computed
+    i.setTime(m_time);
 
     auto const& h_table_data = m_h_data_2D.table();
     data.storeChunkRaw(
@@ -124,7 +124,7 @@ void ParticleMomentum::ComputeDiags (int step)
     // Get number of species
     const int nSpecies = mypc.nSpecies();
 
-    amrex::Real Wtot = 0.0_rt;
+    m_sum_weights.resize(nSpecies);
 
     // Loop over species
     for (int i_s = 0; i_s < nSpecies; ++i_s)
@@ -160,13 +160,8 @@ void ParticleMomentum::ComputeDiags (int step)
         amrex::Real Pz = amrex::get<2>(r);
         amrex::Real Ws = amrex::get<3>(r);
 
-        // Reduced sum over MPI ranks
-        ParallelDescriptor::ReduceRealSum({Px,Py,Pz,Ws}, ParallelDescriptor::IOProcessorNumber());
-
-        // Accumulate sum of weights over all species (must come after MPI reduction of Ws)
-        Wtot += Ws;
-
-        // Save results for this species i_s into m_data
+        // Save the local results for this species i_s into m_data, and the local
+        // sum of weights into m_sum_weights: they are summed over MPI ranks below
 
         // Offset:
         // 3 values of total momentum for all  species +
@@ -175,60 +170,84 @@ void ParticleMomentum::ComputeDiags (int step)
         m_data[offset_total_species+0] = Px;
         m_data[offset_total_species+1] = Py;
         m_data[offset_total_species+2] = Pz;
+        m_sum_weights[i_s] = Ws;
+    }
 
-        // Offset:
-        // 3 values of total momentum for all  species +
-        // 3 values of total momentum for each species +
-        // 3 values of mean  momentum for all  species +
-        // 3 values of mean  momentum for each species
-        const int offset_mean_species = 3 + nSpecies*3 + 3 + i_s*3;
-        if (Ws > std::numeric_limits<Real>::min())
+    // Reduced sum over MPI ranks
+    ReduceRealSum(m_data.data() + 3, 3*nSpecies, ParallelDescriptor::IOProcessorNumber());
+    ReduceRealSum(m_sum_weights.data(), nSpecies, ParallelDescriptor::IOProcessorNumber());
+
+    // The mean and total momenta are computed once the sums are complete
+    AfterReductions([this, nSpecies] ()
+    {
+        amrex::Real Wtot = 0.0_rt;
+
+        // Loop over species
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
         {
-            m_data[offset_mean_species+0] = Px / Ws;
-            m_data[offset_mean_species+1] = Py / Ws;
-            m_data[offset_mean_species+2] = Pz / Ws;
+            const int offset_total_species = 3 + i_s*3;
+            const amrex::Real Px = m_data[offset_total_species+0];
+            const amrex::Real Py = m_data[offset_total_species+1];
+            const amrex::Real Pz = m_data[offset_total_species+2];
+            const amrex::Real Ws = m_sum_weights[i_s];
+
+            // Accumulate sum of weights over all species
+            Wtot += Ws;
+
+            // Offset:
+            // 3 values of total momentum for all  species +
+            // 3 values of total momentum for each species +
+            // 3 values of mean  momentum for all  species +
+            // 3 values of mean  momentum for each species
+            const int offset_mean_species = 3 + nSpecies*3 + 3 + i_s*3;
+            if (Ws > std::numeric_limits<Real>::min())
+            {
+                m_data[offset_mean_species+0] = Px / Ws;
+                m_data[offset_mean_species+1] = Py / Ws;
+                m_data[offset_mean_species+2] = Pz / Ws;
+            }
+            else
+            {
+                m_data[offset_mean_species+0] = 0.0_rt;
+                m_data[offset_mean_species+1] = 0.0_rt;
+                m_data[offset_mean_species+2] = 0.0_rt;
+            }
         }
-        else
+
+        // Total momentum
+        m_data[0] = 0.0_rt;
+        m_data[1] = 0.0_rt;
+        m_data[2] = 0.0_rt;
+
+        // Loop over species
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
         {
-            m_data[offset_mean_species+0] = 0.0_rt;
-            m_data[offset_mean_species+1] = 0.0_rt;
-            m_data[offset_mean_species+2] = 0.0_rt;
+            // Offset:
+            // 3 values of total momentum for all  species +
+            // 3 values of total momentum for each species
+            const int offset_total_species = 3 + i_s*3;
+            m_data[0] += m_data[offset_total_species+0];
+            m_data[1] += m_data[offset_total_species+1];
+            m_data[2] += m_data[offset_total_species+2];
         }
-    }
-
-    // Total momentum
-    m_data[0] = 0.0_rt;
-    m_data[1] = 0.0_rt;
-    m_data[2] = 0.0_rt;
 
-    // Loop over species
-    for (int i_s = 0; i_s < nSpecies; ++i_s)
-    {
-        // Offset:
+        // Total mean momentum. Offset:
         // 3 values of total momentum for all  species +
         // 3 values of total momentum for each species
-        const int offset_total_species = 3 + i_s*3;
-        m_data[0] += m_data[offset_total_species+0];
-        m_data[1] += m_data[offset_total_species+1];
-        m_data[2] += m_data[offset_total_species+2];
-    }
-
-    // Total mean momentum. Offset:
-    // 3 values of total momentum for all  species +
-    // 3 values of total momentum for each species
-    const int offset_mean_all = 3 + nSpecies*3;
-    if (Wtot > std::numeric_limits<Real>::min())
-    {
-        m_data[offset_mean_all+0] = m_data[0] / Wtot;
-        m_data[offset_mean_all+1] = m_data[1] / Wtot;
-        m_data[offset_mean_all+2] = m_data[2] / Wtot;
-    }
-    else
-    {
-        m_data[offset_mean_all+0] = 0.0_rt;
-        m_data[offset_mean_all+1] = 0.0_rt;
-        m_data[offset_mean_all+2] = 0.0_rt;
-    }
+        const int offset_mean_all = 3 + nSpecies*3;
+        if (Wtot > std::numeric_limits<Real>::min())
+        {
+            m_data[offset_mean_all+0] = m_data[0] / Wtot;
+            m_data[offset_mean_all+1] = m_data[1] / Wtot;
+            m_data[offset_mean_all+2] = m_data[2] / Wtot;
+        }
+        else
+        {
+            m_data[offset_mean_all+0] = 0.0_rt;
+            m_data[offset_mean_all+1] = 0.0_rt;
+            m_data[offset_mean_all+2] = 0.0_rt;
+        }
+    });
 
     // m_data contains up-to-date values for:
     // [total momentum along x (all species)
@@ -114,11 +114,13 @@ void ParticleNumber::ComputeDiags (int step)
         // get WarpXParticleContainer class object
         auto & myspc = mypc.GetParticleContainer(i_s);
 
-        // Save total number of macroparticles for this species
-        m_data[idx_first_species_macroparticles + i_s] = myspc.TotalNumberOfParticles();
+        // Save local number of macroparticles for this species
+        constexpr bool only_valid = true, only_local = true;
+        m_data[idx_first_species_macroparticles + i_s] =
+            static_cast<amrex::Real>(myspc.TotalNumberOfParticles(only_valid, only_local));
 
-        // Save sum of particles weight for this species
-        m_data[idx_first_species_sum_weight + i_s] = myspc.sumParticleWeight(false);
+        // Save local sum of particles weight for this species
+        m_data[idx_first_species_sum_weight + i_s] = myspc.sumParticleWeight(only_local);
 
         // Increase total number of macroparticles and total weight (all species)
         m_data[idx_total_macroparticles] += m_data[idx_first_species_macroparticles + i_s];
@@ -126,6 +128,9 @@ void ParticleNumber::ComputeDiags (int step)
     }
     // end loop over species
 
+    // Reduced sum over MPI ranks
+    ReduceRealSum(m_data.data(), static_cast<int>(m_data.size()));
+
     /* m_data now contains up-to-date values for:
      *  [total number of macroparticles (all species),
      *   total number of macroparticles (species 1),
@@ -0,0 +1,186 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "PerformanceCounters.H"
+
+#include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "Utils/TextMsg.H"
+#include "WarpX.H"
+
+#include <ablastr/utils/counters/Counters.H>
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+
+#ifdef AMREX_USE_MPI
+#   include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+using namespace amrex;
+
+namespace
+{
+    /** Name of a counter as a JSON string */
+    std::string jsonString (const std::string& name)
+    {
+        std::string quoted = "\"";
+        for (const char c : name) {
+            if (c == '"' || c == '\\') { quoted += '\\'; }
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+}
+
+// constructor
+PerformanceCounters::PerformanceCounters (const std::string& rd_name)
+    : ReducedDiags{rd_name, "jsonl"}
+{
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_format == "text",
+        "PerformanceCounters reduced diagnostics only support the text format (one line of JSON per output)");
+
+    ablastr::utils::counters::SetEnabled(true);
+
+    // synchronizing the GPU makes the timers accurate, but serializes the timed sections
+    bool synchronize_timers = false;
+    const ParmParse pp_rd_name(rd_name);
+    pp_rd_name.query("synchronize_timers", synchronize_timers);
+    ablastr::utils::counters::SetSynchronizeTimers(synchronize_timers);
+
+#ifdef AMREX_USE_MPI
+    // count the compute nodes, as the number of ranks that are first on their node
+    MPI_Comm node_comm;
+    BL_MPI_REQUIRE( MPI_Comm_split_type(ParallelDescriptor::Communicator(), MPI_COMM_TYPE_SHARED,
+                                        ParallelDescriptor::MyProc(), MPI_INFO_NULL, &node_comm) );
+    int rank_in_node = 0;
+    BL_MPI_REQUIRE( MPI_Comm_rank(node_comm, &rank_in_node) );
+    BL_MPI_REQUIRE( MPI_Comm_free(&node_comm) );
+    m_nnodes = (rank_in_node == 0) ? 1 : 0;
+    ParallelDescriptor::ReduceIntSum(m_nnodes);
+#endif
+}
+
+void PerformanceCounters::InitData ()
+{
+    ablastr::utils::counters::Reset();
+    m_previous_step = WarpX::GetInstance().getistep(0);
+    m_previous_wall_time = ParallelDescriptor::second();
+}
+
+void PerformanceCounters::UpdateNames (const std::map<std::string, double>& local_counters)
+{
+    int has_new_names = 0;
+    for (const auto& counter : local_counters) {
+        if (!std::binary_search(m_names.begin(), m_names.end(), counter.first)) { has_new_names = 1; }
+    }
+    ParallelDescriptor::ReduceIntMax(has_new_names);
+    if (has_new_names == 0) { return; }
+
+    std::set<std::string> names(m_names.begin(), m_names.end());
+    for (const auto& counter : local_counters) { names.insert(counter.first); }
+
+#ifdef AMREX_USE_MPI
+    // gather the names of all the ranks on the I/O rank, separated by new lines
+    std::string local_names;
+    for (const auto& name : names) { local_names += name + "\n"; }
+    int length = static_cast<int>(local_names.size());
+
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int io_proc = ParallelDescriptor::IOProcessorNumber();
+    std::vector<int> recvcount(nprocs, 0);
+    std::vector<int> disp(nprocs, 0);
+    ParallelDescriptor::Gather(&length, 1, recvcount.data(), 1, io_proc);
+
+    std::string recvbuf;
+    if (ParallelDescriptor::IOProcessor()) {
+        for (int i = 1; i < nprocs; ++i) { disp[i] = disp[i-1] + recvcount[i-1]; }
+        recvbuf.resize(disp[nprocs-1] + recvcount[nprocs-1]);
+    }
+    ParallelDescriptor::Gatherv(local_names.data(), length, recvbuf.data(), recvcount, disp, io_proc);
+
+    // broadcast the union of the names
+    std::string all_names;
+    if (ParallelDescriptor::IOProcessor()) {
+        for (const auto& name : amrex::Tokenize(recvbuf, "\n")) { names.insert(name); }
+        for (const auto& name : names) { all_names += name + "\n"; }
+    }
+    length = static_cast<int>(all_names.size());
+    ParallelDescriptor::Bcast(&length, 1, io_proc);
+    all_names.resize(length);
+    ParallelDescriptor::Bcast(all_names.data(), length, io_proc);
+
+    const auto all_names_vec = amrex::Tokenize(all_names, "\n");
+    m_names.assign(all_names_vec.begin(), all_names_vec.end());
+#else
+    m_names.assign(names.begin(), names.end());
+#endif
+}
+
+void PerformanceCounters::ComputeDiags (int step)
+{
+    // Judge if the diags should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    const auto local_counters = ablastr::utils::counters::Values();
+    UpdateNames(local_counters);
+
+    const auto ncounters = static_cast<int>(m_names.size());
+    std::vector<double> sums(ncounters, 0.0);
+    for (int i = 0; i < ncounters; ++i) {
+        const auto it = local_counters.find(m_names[i]);
+        if (it != local_counters.end()) { sums[i] = it->second; }
+    }
+    std::vector<double> maxs = sums;
+
+    const int io_proc = ParallelDescriptor::IOProcessorNumber();
+    ParallelReduce::Sum(sums.data(), ncounters, io_proc, ParallelDescriptor::Communicator());
+    ParallelReduce::Max(maxs.data(), ncounters, io_proc, ParallelDescriptor::Communicator());
+
+    ablastr::utils::counters::Reset();
+
+    const double wall_time = ParallelDescriptor::second();
+    const double elapsed = wall_time - m_previous_wall_time;
+    const int nsteps = step + 1 - m_previous_step;
+    m_previous_wall_time = wall_time;
+    m_previous_step = step + 1;
+
+    if (!ParallelDescriptor::IOProcessor()) { return; }
+
+    double particles_pushed = 0.0;
+    for (int i = 0; i < ncounters; ++i) {
+        if (m_names[i].rfind("particles_pushed/", 0) == 0) { particles_pushed += sums[i]; }
+    }
+
+    std::ostringstream ofs;
+    ofs << std::setprecision(m_precision);
+    ofs << "{\"step\": " << step+1
+        << ", \"time\": " << m_time
+        << ", \"nsteps\": " << nsteps
+        << ", \"wall_time\": " << elapsed
+        << ", \"nprocs\": " << ParallelDescriptor::NProcs()
+        << ", \"nnodes\": " << m_nnodes
+        << ", \"particles_per_second_per_node\": "
+        << ((elapsed > 0.0) ? particles_pushed/elapsed/m_nnodes : 0.0)
+        << ", \"counters\": {";
+    for (int i = 0; i < ncounters; ++i) {
+        if (i > 0) { ofs << ", "; }
+        ofs << jsonString(m_names[i]) << ": {\"sum\": " << sums[i] << ", \"max\": " << maxs[i] << "}";
+    }
+    ofs << "}}\n";
+    m_json_line = ofs.str();
+}
+
+void PerformanceCounters::WriteToFile (int /*step*/)
+{
+    WriteBuffered(m_json_line);
+}
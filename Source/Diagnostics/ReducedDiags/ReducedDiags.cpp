@@ -17,14 +17,28 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_Utility.H>
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
+#include <ios>
+#include <sstream>
 
 using namespace amrex;
 
+namespace
+{
+    /** Append the binary representation of value to buffer */
+    template <typename T>
+    void appendBinary (std::string& buffer, T value)
+    {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
 // constructor
-ReducedDiags::ReducedDiags (const std::string& rd_name):
-m_rd_name{rd_name}
+ReducedDiags::ReducedDiags (const std::string& rd_name, const std::string& default_extension):
+m_extension{default_extension}, m_rd_name{rd_name}
 {
     BackwardCompatibility();
 
@@ -33,6 +47,13 @@ m_rd_name{rd_name}
     // read path
     pp_rd_name.query("path", m_path);
 
+    // read output format
+    pp_rd_name.query("format", m_format);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_format == "text" || m_format == "binary",
+        m_rd_name + ".format must be text or binary");
+    if (m_format == "binary") { m_extension = "bin"; }
+
     // read extension
     pp_rd_name.query("extension", m_extension);
 
@@ -69,9 +90,81 @@ m_rd_name{rd_name}
 
     // precision of data in the output file
     utils::parser::queryWithParser(pp_rd_name, "precision", m_precision);
+
+    // buffering of the output in memory
+    utils::parser::queryWithParser(pp_rd_name, "flush_steps", m_flush_steps);
+    utils::parser::queryWithParser(pp_rd_name, "flush_bytes", m_flush_bytes);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_flush_steps > 0,
+        m_rd_name + ".flush_steps must be positive");
+    if (ParallelDescriptor::IOProcessor() && m_flush_steps > 1) {
+        m_buffer.reserve(m_flush_bytes);
+    }
 }
 // end constructor
 
+void ReducedDiags::ReduceRealSum (amrex::Real* data, int n)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Sum, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealSum(data, n);
+    }
+}
+
+void ReducedDiags::ReduceRealMax (amrex::Real* data, int n)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Max, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealMax(data, n);
+    }
+}
+
+void ReducedDiags::ReduceRealMin (amrex::Real* data, int n)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Min, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealMin(data, n);
+    }
+}
+
+void ReducedDiags::ReduceRealSum (amrex::Real* data, int n, int cpu)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Sum, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealSum(data, n, cpu);
+    }
+}
+
+void ReducedDiags::ReduceRealMax (amrex::Real* data, int n, int cpu)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Max, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealMax(data, n, cpu);
+    }
+}
+
+void ReducedDiags::ReduceRealMin (amrex::Real* data, int n, int cpu)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->Add(DeferredReductions::Op::Min, data, n);
+    } else {
+        ParallelDescriptor::ReduceRealMin(data, n, cpu);
+    }
+}
+
+void ReducedDiags::AfterReductions (const std::function<void()>& f)
+{
+    if (m_deferred_reductions) {
+        m_deferred_reductions->AddCallback(f);
+    } else {
+        f();
+    }
+}
+
 void ReducedDiags::InitData ()
 {
     // Defines an empty function InitData() to be overwritten if needed.
@@ -98,11 +191,23 @@ void ReducedDiags::BackwardCompatibility () const
 }
 
 // write to file function
-void ReducedDiags::WriteToFile (int step) const
+void ReducedDiags::WriteToFile (int step)
 {
-    // open file
-    std::ofstream ofs{m_path + m_rd_name + "." + m_extension,
-        std::ofstream::out | std::ofstream::app};
+    if (m_format == "binary")
+    {
+        // one record per step: step (int64), number of values (int64),
+        // then time and data (float64)
+        std::string record;
+        appendBinary(record, static_cast<std::int64_t>(step+1));
+        appendBinary(record, static_cast<std::int64_t>(m_data.size() + 1));
+        appendBinary(record, static_cast<double>(m_time));
+        for (const auto& item : m_data) { appendBinary(record, static_cast<double>(item)); }
+
+        WriteBuffered(record);
+        return;
+    }
+
+    std::ostringstream ofs;
 
     // write step
     ofs << step+1;
@@ -113,7 +218,7 @@ void ReducedDiags::WriteToFile (int step) const
     ofs << std::fixed << std::setprecision(m_precision) << std::scientific;
 
     // write time
-    ofs << WarpX::GetInstance().gett_new(0);
+    ofs << m_time;
 
     // loop over data size and write
     for (const auto& item : m_data) { ofs << m_sep << item; }
@@ -123,7 +228,36 @@ void ReducedDiags::WriteToFile (int step) const
     // end line
     ofs << "\n";
 
+    WriteBuffered(ofs.str());
+}
+// end ReducedDiags::WriteToFile
+
+void ReducedDiags::WriteBuffered (const std::string& output)
+{
+    m_buffer.append(output);
+    ++m_buffered_steps;
+
+    if (m_buffered_steps >= m_flush_steps ||
+        m_buffer.size() >= static_cast<std::size_t>(m_flush_bytes))
+    {
+        FlushToFile();
+    }
+}
+
+void ReducedDiags::FlushToFile ()
+{
+    if (m_buffer.empty()) { return; }
+
+    // open file
+    std::ofstream ofs{m_path + m_rd_name + "." + m_extension,
+        std::ofstream::out | std::ofstream::app | std::ofstream::binary};
+
+    ofs.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+
     // close file
     ofs.close();
+
+    // the capacity of the buffer is kept, to be reused for the next steps
+    m_buffer.clear();
+    m_buffered_steps = 0;
 }
-// end ReducedDiags::WriteToFile
@@ -158,18 +158,26 @@ void RhoMaximum::ComputeDiags (int step)
         constexpr int idx_min_rho_data = 1;
         constexpr int idx_first_species_data = 2;
 
-        // Fill output array with min and max of total rho
-        m_data[lev*noutputs_per_level + idx_max_rho_data] = mf_temp.max(icomp);
-        m_data[lev*noutputs_per_level + idx_min_rho_data] = mf_temp.min(icomp);
+        // Fill output array with the local min and max of total rho,
+        // which are reduced over MPI ranks below
+        constexpr int nghost = 0;
+        constexpr bool local = true;
+        m_data[lev*noutputs_per_level + idx_max_rho_data] = mf_temp.max(icomp, nghost, local);
+        m_data[lev*noutputs_per_level + idx_min_rho_data] = mf_temp.min(icomp, nghost, local);
 
         // Loop over all charged species
         for (int i = 0; i < n_charged_species; ++i)
         {
             // Fill temporary MultiFAB with the species charge density
             m_rho_functors[lev][idx_first_species_functor+i]->operator()(mf_temp, icomp, i_buffer);
-            // Fill output array with max |rho| of species
-            m_data[lev*noutputs_per_level + idx_first_species_data + i] = mf_temp.norm0();
+            // Fill output array with the local max |rho| of species
+            m_data[lev*noutputs_per_level + idx_first_species_data + i] = mf_temp.norm0(icomp, nghost, local);
         }
+
+        // MPI reduce
+        ReduceRealMax(m_data.data() + lev*noutputs_per_level + idx_max_rho_data, 1);
+        ReduceRealMin(m_data.data() + lev*noutputs_per_level + idx_min_rho_data, 1);
+        ReduceRealMax(m_data.data() + lev*noutputs_per_level + idx_first_species_data, n_charged_species);
     }
     // end loop over refinement levels
 
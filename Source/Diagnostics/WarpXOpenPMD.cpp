@@ -43,13 +43,17 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdint>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <regex>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace detail
@@ -380,7 +384,9 @@ WarpXOpenPMDPlot::WarpXOpenPMDPlot (
     const std::string& engine_type,
     const std::map< std::string, std::string >& engine_parameters,
     const std::vector<bool>& fieldPMLdirections,
-    const std::string& authors)
+    const std::string& authors,
+    bool async_flush,
+    int async_queue_depth)
     : m_Series(nullptr),
       m_MPIRank{amrex::ParallelDescriptor::MyProc()},
       m_MPISize{amrex::ParallelDescriptor::NProcs()},
@@ -391,15 +397,74 @@ WarpXOpenPMDPlot::WarpXOpenPMDPlot (
 {
     m_OpenPMDoptions = detail::getSeriesOptions(operator_type, operator_parameters,
                                                 engine_type, engine_parameters);
+
+    if (async_flush) {
+        // the I/O thread calls MPI concurrently with the main thread
+        bool thread_multiple = true;
+#if defined(AMREX_USE_MPI)
+        if (m_MPISize > 1) {
+            int provided = MPI_THREAD_SINGLE;
+            BL_MPI_REQUIRE( MPI_Query_thread(&provided) );
+            thread_multiple = (provided == MPI_THREAD_MULTIPLE);
+        }
+#endif
+        if (thread_multiple) {
+#if defined(AMREX_USE_MPI)
+            // separate communicator, so that the collective operations of the I/O thread
+            // do not interleave with those of the main thread
+            BL_MPI_REQUIRE( MPI_Comm_dup(amrex::ParallelDescriptor::Communicator(), &m_io_comm) );
+#endif
+            m_io_queue = std::make_unique<AsyncIOQueue>(async_queue_depth);
+        } else {
+            ablastr::warn_manager::WMRecordWarning("Diagnostics",
+                "openPMD: the asynchronous flush requires an MPI library initialized "
+                "with MPI_THREAD_MULTIPLE. The output is written synchronously instead.");
+        }
+    }
 }
 
 WarpXOpenPMDPlot::~WarpXOpenPMDPlot ()
 {
+  // complete the output of the I/O thread, and run the tasks of an unclosed step
+  if (m_io_queue) {
+      try {
+          m_io_queue->Wait();
+      } catch (std::exception const& e) {
+          WARPX_ABORT_WITH_MESSAGE(std::string("openPMD: asynchronous flush failed: ") + e.what());
+      }
+      m_io_queue.reset();
+  }
+  for (auto const& task : m_pending_tasks) { RunTask(task); }
+
   if( m_Series )
   {
     m_Series->flush();
     m_Series.reset( nullptr );
   }
+
+#if defined(AMREX_USE_MPI)
+  if (m_io_comm != MPI_COMM_NULL) { MPI_Comm_free(&m_io_comm); }
+#endif
+}
+
+void
+WarpXOpenPMDPlot::Submit (std::function<void()> task)
+{
+    if (m_io_queue) {
+        m_pending_tasks.push_back(std::move(task));
+    } else {
+        RunTask(task);
+    }
+}
+
+void
+WarpXOpenPMDPlot::RunTask (std::function<void()> const& task)
+{
+    try {
+        task();
+    } catch (std::exception const& e) {
+        WARPX_ABORT_WITH_MESSAGE(std::string("openPMD: ") + e.what());
+    }
 }
 
 std::string
@@ -454,71 +519,92 @@ void WarpXOpenPMDPlot::CloseStep (bool isBTD, bool isLastBTDFlush)
     // close BTD file only when isLastBTDFlush is true
     if (isBTD and !isLastBTDFlush) { callClose = false; }
     if (callClose) {
-        if (m_Series) {
-            GetIteration(m_CurrentStep, isBTD).close();
-        }
+        // see Init()
+        std::string filepath = m_dirPrefix;
+        std::string const filename = GetFileName(filepath);
+
+        bool const is_io_processor = amrex::ParallelDescriptor::IOProcessor();
+        Submit([this, current_step = m_CurrentStep, isBTD, dirPrefix = m_dirPrefix, filename,
+                is_io_processor] () {
+            if (m_Series) {
+                GetIteration(current_step, isBTD).close();
+            }
 
-        // create a little helper file for ParaView 5.9+
-        if (amrex::ParallelDescriptor::IOProcessor())
-        {
-            // see Init()
-            std::string filepath = m_dirPrefix;
-            std::string const filename = GetFileName(filepath);
+            // create a little helper file for ParaView 5.9+
+            if (is_io_processor)
+            {
+                std::ofstream pv_helper_file(dirPrefix + "/paraview.pmd");
+                pv_helper_file << filename << "\n";
+                pv_helper_file.close();
+            }
+        });
+    }
 
-            std::ofstream pv_helper_file(m_dirPrefix + "/paraview.pmd");
-            pv_helper_file << filename << "\n";
-            pv_helper_file.close();
+    // hand the tasks of this step over to the I/O thread, which writes the step to disk
+    // while the simulation continues (waiting first if too many steps are in progress)
+    if (m_io_queue && !m_pending_tasks.empty()) {
+        WARPX_PROFILE("WarpXOpenPMDPlot::CloseStep::SubmitAsync");
+        try {
+            m_io_queue->Submit([tasks = std::move(m_pending_tasks)] () {
+                for (auto const& task : tasks) { task(); }
+            });
+        } catch (std::exception const& e) {
+            // error of a previous step, rethrown on the main thread
+            WARPX_ABORT_WITH_MESSAGE(std::string("openPMD: asynchronous flush failed: ") + e.what());
         }
+        m_pending_tasks.clear();
     }
 }
 
 void
 WarpXOpenPMDPlot::Init (openPMD::Access access, bool isBTD)
 {
-    if( isBTD && m_Series != nullptr ) {
-        return; // already open for this snapshot (aka timestep in lab frame)
-    }
-
     // either for the next ts file,
     // or init a single file for all ts
     std::string filepath = m_dirPrefix;
     GetFileName(filepath);
 
-    // close a previously open series before creating a new one
-    // see ADIOS1 limitation: https://github.com/openPMD/openPMD-api/pull/686
-    if ( m_Encoding == openPMD::IterationEncoding::fileBased ) {
-        m_Series = nullptr;
-    } else if ( m_Series != nullptr ) {
-        return;
-    }
+    Submit([this, filepath, access, isBTD] () {
+        if( isBTD && m_Series != nullptr ) {
+            return; // already open for this snapshot (aka timestep in lab frame)
+        }
 
-    if (amrex::ParallelDescriptor::NProcs() > 1) {
+        // close a previously open series before creating a new one
+        // see ADIOS1 limitation: https://github.com/openPMD/openPMD-api/pull/686
+        if ( m_Encoding == openPMD::IterationEncoding::fileBased ) {
+            m_Series = nullptr;
+        } else if ( m_Series != nullptr ) {
+            return;
+        }
+
+        if (amrex::ParallelDescriptor::NProcs() > 1) {
 #if defined(AMREX_USE_MPI)
-        m_Series = std::make_unique<openPMD::Series>(
-                filepath, access,
-                amrex::ParallelDescriptor::Communicator(),
-                m_OpenPMDoptions
-        );
+            m_Series = std::make_unique<openPMD::Series>(
+                    filepath, access,
+                    (m_io_comm != MPI_COMM_NULL) ? m_io_comm : amrex::ParallelDescriptor::Communicator(),
+                    m_OpenPMDoptions
+            );
 #else
-        WARPX_ABORT_WITH_MESSAGE("openPMD-api not built with MPI support!");
+            throw std::runtime_error("openPMD-api not built with MPI support!");
 #endif
-    } else {
-        m_Series = std::make_unique<openPMD::Series>(filepath, access, m_OpenPMDoptions);
-    }
+        } else {
+            m_Series = std::make_unique<openPMD::Series>(filepath, access, m_OpenPMDoptions);
+        }
 
-    m_Series->setIterationEncoding( m_Encoding );
+        m_Series->setIterationEncoding( m_Encoding );
 
-    // input file / simulation setup author
-    if( !m_authors.empty()) {
-        m_Series->setAuthor( m_authors );
-    }
-    // more natural naming for PIC
-    m_Series->setMeshesPath( "fields" );
-    // conform to ED-PIC extension of openPMD
-    uint32_t const openPMD_ED_PIC = 1u;
-    m_Series->setOpenPMDextension( openPMD_ED_PIC );
-    // meta info
-    m_Series->setSoftware( "WarpX", WarpX::Version() );
+        // input file / simulation setup author
+        if( !m_authors.empty()) {
+            m_Series->setAuthor( m_authors );
+        }
+        // more natural naming for PIC
+        m_Series->setMeshesPath( "fields" );
+        // conform to ED-PIC extension of openPMD
+        uint32_t const openPMD_ED_PIC = 1u;
+        m_Series->setOpenPMDextension( openPMD_ED_PIC );
+        // meta info
+        m_Series->setSoftware( "WarpX", WarpX::Version() );
+    });
 }
 
 void
@@ -541,9 +627,10 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
         }
     }
 
-    PinnedMemoryParticleContainer tmp = (isBTD || use_pinned_pc) ?
+    // shared with the asynchronous I/O tasks, which write the particle data directly from it
+    auto tmp = std::make_shared<PinnedMemoryParticleContainer>((isBTD || use_pinned_pc) ?
         pinned_pc->make_alike<amrex::PinnedArenaAllocator>() :
-        pc->make_alike<amrex::PinnedArenaAllocator>();
+        pc->make_alike<amrex::PinnedArenaAllocator>());
 
     const auto mass = pc->AmIA<PhysicalSpecies::photon>() ? PhysConst::m_e : pc->getMass();
     RandomFilter const random_filter(particle_diags[i].m_do_random_filter,
@@ -561,7 +648,7 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
     if (isBTD || use_pinned_pc) {
         particlesConvertUnits(ConvertDirection::WarpX_to_SI, pinned_pc, mass);
         using SrcData = WarpXParticleContainer::ParticleTileType::ConstParticleTileDataType;
-        tmp.copyParticles(*pinned_pc,
+        tmp->copyParticles(*pinned_pc,
             [random_filter,uniform_filter,parser_filter,geometry_filter]
             AMREX_GPU_HOST_DEVICE
             (const SrcData& src, int ip, const amrex::RandomEngine& engine)
@@ -574,7 +661,7 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
     } else {
         particlesConvertUnits(ConvertDirection::WarpX_to_SI, pc, mass);
         using SrcData = WarpXParticleContainer::ParticleTileType::ConstParticleTileDataType;
-        tmp.copyParticles(*pc,
+        tmp->copyParticles(*pc,
             [random_filter,uniform_filter,parser_filter,geometry_filter]
             AMREX_GPU_HOST_DEVICE
             (const SrcData& src, int ip, const amrex::RandomEngine& engine)
@@ -588,7 +675,7 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
 
     // Gather the electrostatic potential (phi) on the macroparticles
     if ( particle_diags[i].m_plot_phi ) {
-        storePhiOnParticles( tmp, WarpX::electrostatic_solver_id, !use_pinned_pc );
+        storePhiOnParticles( *tmp, WarpX::electrostatic_solver_id, !use_pinned_pc );
     }
 
     // names of amrex::Real and int particle attributes in SoA data
@@ -612,28 +699,28 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
     real_names.push_back("momentum_y");
     real_names.push_back("momentum_z");
     // get the names of the real comps
-    real_names.resize(tmp.NumRealComps());
-    auto runtime_rnames = tmp.getParticleRuntimeComps();
+    real_names.resize(tmp->NumRealComps());
+    auto runtime_rnames = tmp->getParticleRuntimeComps();
     for (auto const& x : runtime_rnames)
     {
         real_names[x.second+PIdx::nattribs] = detail::snakeToCamel(x.first);
     }
     // plot any "extra" fields by default
     real_flags = particle_diags[i].m_plot_flags;
-    real_flags.resize(tmp.NumRealComps(), 1);
+    real_flags.resize(tmp->NumRealComps(), 1);
     // and the names
-    int_names.resize(tmp.NumIntComps());
-    auto runtime_inames = tmp.getParticleRuntimeiComps();
+    int_names.resize(tmp->NumIntComps());
+    auto runtime_inames = tmp->getParticleRuntimeiComps();
     for (auto const& x : runtime_inames)
     {
         int_names[x.second+0] = detail::snakeToCamel(x.first);
     }
     // plot by default
-    int_flags.resize(tmp.NumIntComps(), 1);
+    int_flags.resize(tmp->NumIntComps(), 1);
 
     // real_names contains a list of all real particle attributes.
     // real_flags is 1 or 0, whether quantity is dumped or not.
-    DumpToFile(&tmp,
+    DumpToFile(tmp,
         particle_diags.at(i).getSpeciesName(),
         m_CurrentStep,
         real_flags,
@@ -645,7 +732,7 @@ for (unsigned i = 0, n = particle_diags.size(); i < n; ++i) {
 }
 
 void
-WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
+WarpXOpenPMDPlot::DumpToFile (std::shared_ptr<ParticleContainer> const& pc,
                     const std::string& name,
                     int iteration,
                     const amrex::Vector<int>& write_real_comp,
@@ -658,73 +745,21 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
                     const bool isLastBTDFlush
 )
 {
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_Series != nullptr, "openPMD: series must be initialized");
-
     AMREX_ALWAYS_ASSERT(write_real_comp.size() == pc->NumRealComps());
     AMREX_ALWAYS_ASSERT(write_int_comp.size() == pc->NumIntComps());
     AMREX_ALWAYS_ASSERT(real_comp_names.size() == pc->NumRealComps());
     AMREX_ALWAYS_ASSERT(int_comp_names.size() == pc->NumIntComps());
 
-    WarpXParticleCounter counter(pc);
+    WarpXParticleCounter counter(pc.get());
     auto const num_dump_particles = counter.GetTotalNumParticles();
 
-    openPMD::Iteration currIteration = GetIteration(iteration, isBTD);
-    openPMD::ParticleSpecies currSpecies = currIteration.particles[name];
-
-    // only BTD writes multiple times into the same step, zero for other methods
-    const unsigned long ParticleFlushOffset = isBTD ? num_already_flushed(currSpecies) : 0;
-
-    // prepare data structures the first time BTD has non-zero particles
-    //   we set some of them to zero extent, so we need to time that well
-    bool const is_first_flush_with_particles = num_dump_particles > 0 && ParticleFlushOffset == 0;
-    // BTD: we flush multiple times to the same lab step and thus need to resize
-    //   our declared particle output sizes
-    bool const is_resizing_flush = num_dump_particles > 0 && ParticleFlushOffset > 0;
-    // write structure & declare particles in this (lab) step empty:
-    //   if not BTD, then this is the only (and last) time we flush to this step
-    //   if BTD, then we may do this multiple times until it is the last BTD flush
-    bool const is_last_flush_to_step = !isBTD || (isBTD && isLastBTDFlush);
-    // well, even in BTD we have to recognize that some lab stations may have no
-    //   particles - so we mark them empty at the end of station reconstruction
-    bool const is_last_flush_and_never_particles =
-            is_last_flush_to_step && num_dump_particles == 0 && ParticleFlushOffset == 0;
-
-    //
-    // prepare structure and meta-data
-    //
-
-    // define positions & offset structure
-    const unsigned long long NewParticleVectorSize = num_dump_particles + ParticleFlushOffset;
-    // we will set up empty particles unless it's BTD, where we might add some in a following buffer dump
-    //   during this setup, we mark some particle properties as constant and potentially zero-sized
-    bool doParticleSetup = true;
-    if (isBTD) {
-        doParticleSetup = is_first_flush_with_particles || is_last_flush_and_never_particles;
-    }
-
     auto const positionComponents = detail::getParticlePositionComponentLabels(write_real_comp, real_comp_names);
 
-    // this setup stage also implicitly calls "makeEmpty" if needed (i.e., is_last_flush_and_never_particles)
-    //   for BTD, we call this multiple times as we may resize in subsequent dumps if number of particles in the buffer > 0
-    if (doParticleSetup || is_resizing_flush) {
-        SetupPos(currSpecies, positionComponents, NewParticleVectorSize, isBTD);
-        SetupRealProperties(pc, currSpecies, write_real_comp, real_comp_names, write_int_comp, int_comp_names,
-                            NewParticleVectorSize, isBTD);
-    }
-
-    if (is_last_flush_to_step) {
-        SetConstParticleRecordsEDPIC(currSpecies, positionComponents, NewParticleVectorSize, charge, mass);
-    }
-
-    // open files from all processors, in case some will not contribute below
-    m_Series->flush();
-
-    // dump individual particles
-    bool contributed_particles = false;  // did the local MPI rank contribute particles?
+    // prepare the individual particles to dump (the offsets do not include
+    // the number of particles already flushed in BTD, which is added when writing)
+    std::vector<ParticleChunkWriter> store_chunks;
     for (auto currentLevel = 0; currentLevel <= pc->finestLevel(); currentLevel++) {
         auto offset = static_cast<uint64_t>( counter.m_ParticleOffsetAtRank[currentLevel] );
-        // For BTD, the offset include the number of particles already flushed
-        if (isBTD) { offset += ParticleFlushOffset; }
         for (ParticleIter pti(*pc, currentLevel); pti.isValid(); ++pti) {
             auto const numParticleOnTile = pti.numParticles();
             auto const numParticleOnTile64 = static_cast<uint64_t>( numParticleOnTile );
@@ -734,11 +769,10 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
             //   https://github.com/ECP-WarpX/WarpX/pull/1898#discussion_r745008290
             if (numParticleOnTile == 0) { continue; }
 
-            contributed_particles = true;
-
             //  save particle properties
             SaveRealProperty(pti,
-                             currSpecies,
+                             pc,
+                             store_chunks,
                              offset,
                              write_real_comp, real_comp_names,
                              write_int_comp, int_comp_names);
@@ -747,62 +781,124 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
         } // pti
     } // currentLevel
 
-    // work-around for BTD particle resize in ADIOS2
-    //
-    // This issues an empty ADIOS2 Put to make sure the new global shape
-    // meta-data is committed for each variable.
-    //
-    // Refs.:
-    //   https://github.com/ECP-WarpX/WarpX/issues/3389
-    //   https://github.com/ornladios/ADIOS2/issues/3455
-    //   BP4 (ADIOS 2.8): last MPI rank's `Put` meta-data wins
-    //   BP5 (ADIOS 2.8): everyone has to write an empty block
-    if (is_resizing_flush && !contributed_particles && isBTD && m_Series->backend() == "ADIOS2") {
-        for( auto & [record_name, record] : currSpecies ) {
-            for( auto & [comp_name, comp] : record ) {
-                if (comp.constant()) { continue; }
-
-                auto dtype = comp.getDatatype();
-                switch (dtype) {
-                    case openPMD::Datatype::FLOAT :
-                        [[fallthrough]];
-                    case openPMD::Datatype::DOUBLE : {
-                        auto empty_data = std::make_shared<amrex::ParticleReal>();
-                        comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
-                        break;
-                    }
-                    case openPMD::Datatype::UINT : {
-                        auto empty_data = std::make_shared<unsigned int>();
-                        comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
-                        break;
-                    }
-                    case openPMD::Datatype::ULONG : {
-                        auto empty_data = std::make_shared<unsigned long>();
-                        comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
-                        break;
-                    }
-                    case openPMD::Datatype::ULONGLONG : {
-                        auto empty_data = std::make_shared<unsigned long long>();
-                        comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
-                        break;
-                    }
-                    default : {
-                        std::string msg = "WarpX openPMD ADIOS2 work-around has unknown dtype: ";
-                        msg += datatypeToString(dtype);
-                        WARPX_ABORT_WITH_MESSAGE(msg);
-                        break;
+    // did the local MPI rank contribute particles?
+    bool const contributed_particles = !store_chunks.empty();
+
+    Submit([this, name, iteration, write_real_comp, write_int_comp, real_comp_names, int_comp_names,
+            charge, mass, isBTD, isLastBTDFlush, num_dump_particles, positionComponents,
+            contributed_particles, store_chunks = std::move(store_chunks)] () {
+        if (m_Series == nullptr) { throw std::runtime_error("series must be initialized"); }
+
+        openPMD::Iteration currIteration = GetIteration(iteration, isBTD);
+        openPMD::ParticleSpecies currSpecies = currIteration.particles[name];
+
+        // only BTD writes multiple times into the same step, zero for other methods
+        const unsigned long ParticleFlushOffset = isBTD ? num_already_flushed(currSpecies) : 0;
+
+        // prepare data structures the first time BTD has non-zero particles
+        //   we set some of them to zero extent, so we need to time that well
+        bool const is_first_flush_with_particles = num_dump_particles > 0 && ParticleFlushOffset == 0;
+        // BTD: we flush multiple times to the same lab step and thus need to resize
+        //   our declared particle output sizes
+        bool const is_resizing_flush = num_dump_particles > 0 && ParticleFlushOffset > 0;
+        // write structure & declare particles in this (lab) step empty:
+        //   if not BTD, then this is the only (and last) time we flush to this step
+        //   if BTD, then we may do this multiple times until it is the last BTD flush
+        bool const is_last_flush_to_step = !isBTD || (isBTD && isLastBTDFlush);
+        // well, even in BTD we have to recognize that some lab stations may have no
+        //   particles - so we mark them empty at the end of station reconstruction
+        bool const is_last_flush_and_never_particles =
+                is_last_flush_to_step && num_dump_particles == 0 && ParticleFlushOffset == 0;
+
+        //
+        // prepare structure and meta-data
+        //
+
+        // define positions & offset structure
+        const unsigned long long NewParticleVectorSize = num_dump_particles + ParticleFlushOffset;
+        // we will set up empty particles unless it's BTD, where we might add some in a following buffer dump
+        //   during this setup, we mark some particle properties as constant and potentially zero-sized
+        bool doParticleSetup = true;
+        if (isBTD) {
+            doParticleSetup = is_first_flush_with_particles || is_last_flush_and_never_particles;
+        }
+
+        // this setup stage also implicitly calls "makeEmpty" if needed (i.e., is_last_flush_and_never_particles)
+        //   for BTD, we call this multiple times as we may resize in subsequent dumps if number of particles in the buffer > 0
+        if (doParticleSetup || is_resizing_flush) {
+            SetupPos(currSpecies, positionComponents, NewParticleVectorSize, isBTD);
+            SetupRealProperties(currSpecies, write_real_comp, real_comp_names, write_int_comp, int_comp_names,
+                                NewParticleVectorSize, isBTD);
+        }
+
+        if (is_last_flush_to_step) {
+            SetConstParticleRecordsEDPIC(currSpecies, positionComponents, NewParticleVectorSize, charge, mass);
+        }
+
+        // open files from all processors, in case some will not contribute below
+        m_Series->flush();
+
+        // dump individual particles
+        // For BTD, the offset include the number of particles already flushed
+        for (auto const& store_chunk : store_chunks) {
+            store_chunk(currSpecies, isBTD ? ParticleFlushOffset : 0);
+        }
+
+        // work-around for BTD particle resize in ADIOS2
+        //
+        // This issues an empty ADIOS2 Put to make sure the new global shape
+        // meta-data is committed for each variable.
+        //
+        // Refs.:
+        //   https://github.com/ECP-WarpX/WarpX/issues/3389
+        //   https://github.com/ornladios/ADIOS2/issues/3455
+        //   BP4 (ADIOS 2.8): last MPI rank's `Put` meta-data wins
+        //   BP5 (ADIOS 2.8): everyone has to write an empty block
+        if (is_resizing_flush && !contributed_particles && isBTD && m_Series->backend() == "ADIOS2") {
+            for( auto & [record_name, record] : currSpecies ) {
+                for( auto & [comp_name, comp] : record ) {
+                    if (comp.constant()) { continue; }
+
+                    auto dtype = comp.getDatatype();
+                    switch (dtype) {
+                        case openPMD::Datatype::FLOAT :
+                            [[fallthrough]];
+                        case openPMD::Datatype::DOUBLE : {
+                            auto empty_data = std::make_shared<amrex::ParticleReal>();
+                            comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
+                            break;
+                        }
+                        case openPMD::Datatype::UINT : {
+                            auto empty_data = std::make_shared<unsigned int>();
+                            comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
+                            break;
+                        }
+                        case openPMD::Datatype::ULONG : {
+                            auto empty_data = std::make_shared<unsigned long>();
+                            comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
+                            break;
+                        }
+                        case openPMD::Datatype::ULONGLONG : {
+                            auto empty_data = std::make_shared<unsigned long long>();
+                            comp.storeChunk(empty_data, {uint64_t(0)}, {uint64_t(0)});
+                            break;
+                        }
+                        default : {
+                            std::string msg = "WarpX openPMD ADIOS2 work-around has unknown dtype: ";
+                            msg += datatypeToString(dtype);
+                            throw std::runtime_error(msg);
+                        }
                     }
                 }
             }
         }
-    }
 
-    m_Series->flush();
+        m_Series->flush();
+    });
 }
 
 void
-WarpXOpenPMDPlot::SetupRealProperties (ParticleContainer const * pc,
-                      openPMD::ParticleSpecies& currSpecies,
+WarpXOpenPMDPlot::SetupRealProperties (openPMD::ParticleSpecies& currSpecies,
                       const amrex::Vector<int>& write_real_comp,
                       const amrex::Vector<std::string>& real_comp_names,
                       const amrex::Vector<int>& write_int_comp,
@@ -836,7 +932,7 @@ WarpXOpenPMDPlot::SetupRealProperties (ParticleContainer const * pc,
     }
 
     std::set< std::string > addedRecords; // add meta-data per record only once
-    for (auto idx=0; idx<pc->NumRealComps(); idx++) {
+    for (auto idx=0; idx<real_counter; idx++) {
         if (write_real_comp[idx]) {
             // handle scalar and non-scalar records by name
             const auto [record_name, component_name] = detail::name2openPMD(real_comp_names[idx]);
@@ -882,7 +978,8 @@ WarpXOpenPMDPlot::SetupRealProperties (ParticleContainer const * pc,
 
 void
 WarpXOpenPMDPlot::SaveRealProperty (ParticleIter& pti,
-                       openPMD::ParticleSpecies& currSpecies,
+                       std::shared_ptr<ParticleContainer> const& pc,
+                       std::vector<ParticleChunkWriter>& store_chunks,
                        unsigned long long const offset,
                        amrex::Vector<int> const& write_real_comp,
                        amrex::Vector<std::string> const& real_comp_names,
@@ -894,17 +991,40 @@ WarpXOpenPMDPlot::SaveRealProperty (ParticleIter& pti,
     auto const numParticleOnTile64 = static_cast<uint64_t>(numParticleOnTile);
     auto const& soa = pti.GetStructOfArrays();
 
-    auto const getComponentRecord = [&currSpecies](std::string const& comp_name) {
+    // store data that is owned by the chunk writer
+    auto const storeChunk = [&](std::string const& comp_name, auto data) {
         // handle scalar and non-scalar records by name
-        const auto [record_name, component_name] = detail::name2openPMD(comp_name);
-        return currSpecies[record_name][component_name];
+        std::string record_name, component_name;
+        std::tie(record_name, component_name) = detail::name2openPMD(comp_name);
+        store_chunks.emplace_back(
+            [record_name, component_name, data, offset, numParticleOnTile64]
+            (openPMD::ParticleSpecies& currSpecies, uint64_t flush_offset) {
+                currSpecies[record_name][component_name].storeChunk(
+                    data, {flush_offset + offset}, {numParticleOnTile64});
+            });
+    };
+    // store data of the particle container: with asynchronous flush, the chunk
+    // shares the ownership of the particle container, which is kept until the data is written
+    auto const storeChunkRaw = [&](std::string const& comp_name, auto const* data) {
+        if (m_io_queue) {
+            using T = std::remove_pointer_t<decltype(data)>;
+            storeChunk(comp_name, std::shared_ptr<T>(pc, data));
+        } else {
+            std::string record_name, component_name;
+            std::tie(record_name, component_name) = detail::name2openPMD(comp_name);
+            store_chunks.emplace_back(
+                [record_name, component_name, data, offset, numParticleOnTile64]
+                (openPMD::ParticleSpecies& currSpecies, uint64_t flush_offset) {
+                    currSpecies[record_name][component_name].storeChunkRaw(
+                        data, {flush_offset + offset}, {numParticleOnTile64});
+                });
+        }
     };
 
     // here we the save the SoA properties (idcpu)
     {
         // todo: add support to not write the particle index
-        getComponentRecord("id").storeChunkRaw(
-            soa.GetIdCPUData().data(), {offset}, {numParticleOnTile64});
+        storeChunkRaw("id", soa.GetIdCPUData().data());
     }
 
     // here we the save the SoA properties (real)
@@ -935,10 +1055,10 @@ WarpXOpenPMDPlot::SaveRealProperty (ParticleIter& pti,
             if (write_real_comp[1]) { y.get()[i] = yp; }
         }
         if (write_real_comp[0]) {
-            getComponentRecord(real_comp_names[0]).storeChunk(x, {offset}, {numParticleOnTile64});
+            storeChunk(real_comp_names[0], x);
         }
         if (write_real_comp[1]) {
-            getComponentRecord(real_comp_names[1]).storeChunk(y, {offset}, {numParticleOnTile64});
+            storeChunk(real_comp_names[1], y);
         }
 #endif
 
@@ -957,8 +1077,7 @@ WarpXOpenPMDPlot::SaveRealProperty (ParticleIter& pti,
             int const soa_r_idx = idx;
 #endif
             if (write_real_comp[idx]) {
-                getComponentRecord(real_comp_names[idx]).storeChunkRaw(
-                    soa.GetRealData(soa_r_idx).data(), {offset}, {numParticleOnTile64});
+                storeChunkRaw(real_comp_names[idx], soa.GetRealData(soa_r_idx).data());
             }
         }
     }
@@ -967,8 +1086,7 @@ WarpXOpenPMDPlot::SaveRealProperty (ParticleIter& pti,
         auto const int_counter = std::min(write_int_comp.size(), int_comp_names.size());
         for (auto idx=0; idx<int_counter; idx++) {
             if (write_int_comp[idx]) {
-                getComponentRecord(int_comp_names[idx]).storeChunkRaw(
-                    soa.GetIntData(idx).data(), {offset}, {numParticleOnTile64});
+                storeChunkRaw(int_comp_names[idx], soa.GetIntData(idx).data());
             }
         }
     }
@@ -1209,7 +1327,7 @@ WarpXOpenPMDPlot::SetupMeshComp (openPMD::Mesh& mesh,
                                  amrex::Geometry const& full_geom,
                                  std::string const& comp_name,
                                  std::string const& field_name,
-                                 amrex::MultiFab const& mf,
+                                 std::vector<double> const& relative_cell_pos,
                                  bool var_in_theta_mode) const
 {
     auto mesh_comp = mesh[comp_name];
@@ -1242,9 +1360,9 @@ WarpXOpenPMDPlot::SetupMeshComp (openPMD::Mesh& mesh,
     mesh_comp.resetDataset(dataset);
 
     detail::setOpenPMDUnit( mesh, field_name );
-    auto relative_cell_pos = utils::getRelativeCellPosition(mf);     // AMReX Fortran index order
-    std::reverse( relative_cell_pos.begin(), relative_cell_pos.end() ); // now in C order
-    mesh_comp.setPosition( relative_cell_pos );
+    // relative_cell_pos is in AMReX Fortran index order
+    std::vector<double> const relative_cell_pos_c(relative_cell_pos.rbegin(), relative_cell_pos.rend());
+    mesh_comp.setPosition( relative_cell_pos_c );
 }
 
 void
@@ -1334,47 +1452,41 @@ WarpXOpenPMDPlot::WriteOpenPMDFieldsAll ( //const std::string& filename,
                       const int iteration,
                       const double time,
                       bool isBTD,
-                      const amrex::Geometry& full_BTD_snapshot ) const
+                      const amrex::Geometry& full_BTD_snapshot )
 {
     //This is AMReX's tiny profiler. Possibly will apply it later
     WARPX_PROFILE("WarpXOpenPMDPlot::WriteOpenPMDFields()");
 
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_Series != nullptr, "openPMD series must be initialized");
-
-    // is this either a regular write (true) or the first write in a
-    // backtransformed diagnostic (BTD):
-    bool const first_write_to_iteration = ! m_Series->iterations.contains( iteration );
-
-    // meta data
-    openPMD::Iteration series_iteration = GetIteration(m_CurrentStep, isBTD);
-
-    // collective open
-    series_iteration.open();
-
-    auto meshes = series_iteration.meshes;
-    if (first_write_to_iteration) {
-        // lets see whether full_geom varies from geom[0]   xgeom[1]
-        series_iteration.setTime( time );
-    }
+    /** A field component of one level, and the functions that store its chunks */
+    struct MeshComponent
+    {
+        std::string field_name;
+        std::string comp_name;
+        bool var_in_theta_mode;
+        std::vector<std::function<void(openPMD::MeshRecordComponent&)>> store_chunks;
+    };
+    /** The field components of one level */
+    struct MeshLevel
+    {
+        amrex::Geometry full_geom;
+        std::vector<double> relative_cell_pos;
+        std::vector<MeshComponent> components;
+    };
 
-    // If there are no fields to be written, interrupt the function here
-    if ( varnames.empty() ) { return; }
+    // Prepare the chunks of all the levels and components. With asynchronous
+    // flush, the data is copied to staging buffers, since mf is not kept until
+    // the data is written.
+    std::vector<MeshLevel> levels;
 
     // loop over levels up to output_levels
     //   note: this is usually the finestLevel, not the maxLevel
-    for (int lev=0; lev < output_levels; lev++) {
-        amrex::Geometry full_geom = geom[lev];
-        if( isBTD ) {
-            full_geom = full_BTD_snapshot;
-        }
-
-        // setup is called once. So it uses property "period" from first
-        // geometry for <all> field levels.
-        if ( (0 == lev) && first_write_to_iteration ) {
-            SetupFields(meshes, full_geom);
-        }
+    // (there is nothing to prepare if there are no fields to be written)
+    for (int lev=0; lev < output_levels && !varnames.empty(); lev++) {
+        MeshLevel& level = levels.emplace_back();
+        level.full_geom = isBTD ? full_BTD_snapshot : geom[lev];
+        level.relative_cell_pos = utils::getRelativeCellPosition(mf[lev]);
 
-        amrex::Box const & global_box = full_geom.Domain();
+        amrex::Box const & global_box = level.full_geom.Domain();
 
         int const ncomp = mf[lev].nComp();
         for ( int icomp=0; icomp<ncomp; icomp++ ) {
@@ -1386,45 +1498,11 @@ WarpXOpenPMDPlot::WriteOpenPMDFieldsAll ( //const std::string& filename,
             std::string comp_name = openPMD::MeshRecordComponent::SCALAR;
             // assume fields are scalar unless they match the following match of known vector fields
             GetMeshCompNames( lev, varname_no_mode, field_name, comp_name, var_in_theta_mode );
-            if ( first_write_to_iteration )
-            {
-                if (comp_name == openPMD::MeshRecordComponent::SCALAR) {
-                    if ( ! meshes.contains(field_name) ) {
-                        auto mesh = meshes[field_name];
-                        SetupMeshComp(  mesh,
-                                        full_geom,
-                                        comp_name,
-                                        field_name,
-                                        mf[lev],
-                                        var_in_theta_mode );
-                    }
-                } else {
-                    auto mesh = meshes[field_name];
-                    if ( ! mesh.contains(comp_name) ) {
-                        SetupMeshComp(  mesh,
-                                        full_geom,
-                                        comp_name,
-                                        field_name,
-                                        mf[lev],
-                                        var_in_theta_mode );
-                    }
-                }
-            }
-        } // icomp setup loop
-
-        for ( int icomp=0; icomp<ncomp; icomp++ ) {
-            std::string const & varname = varnames[icomp];
-
-            auto [varname_no_mode, mode_index] = GetFieldNameModeInt(varname);
-            [[maybe_unused]] const bool var_in_theta_mode = mode_index != -1;
-
-            std::string field_name(varname_no_mode);
-            std::string comp_name = openPMD::MeshRecordComponent::SCALAR;
-            // assume fields are scalar unless they match the following match of known vector fields
-            GetMeshCompNames( lev, varname_no_mode, field_name, comp_name, var_in_theta_mode );
 
-            auto mesh = meshes[field_name];
-            auto mesh_comp = mesh[comp_name];
+            MeshComponent& component = level.components.emplace_back();
+            component.field_name = field_name;
+            component.comp_name = comp_name;
+            component.var_in_theta_mode = var_in_theta_mode;
 
             // Loop through the multifab, and store each box as a chunk,
             // in the openPMD file.
@@ -1452,23 +1530,105 @@ WarpXOpenPMDPlot::WriteOpenPMDFieldsAll ( //const std::string& filename,
                     std::shared_ptr<amrex::Real> data_pinned(foo.release());
                     amrex::Gpu::dtoh_memcpy_async(data_pinned.get(), fab.dataPtr(icomp), local_box.numPts()*sizeof(amrex::Real));
                     // intentionally delayed until before we .flush(): amrex::Gpu::streamSynchronize();
-                    mesh_comp.storeChunk(data_pinned, chunk_offset, chunk_size);
+                    component.store_chunks.emplace_back(
+                        [data_pinned, chunk_offset, chunk_size] (openPMD::MeshRecordComponent& mesh_comp) {
+                            mesh_comp.storeChunk(data_pinned, chunk_offset, chunk_size);
+                        });
                 } else
 #endif
-                {
+                if (m_io_queue) {
+                    std::shared_ptr<amrex::Real> const data_staged(
+                        new amrex::Real[local_box.numPts()], std::default_delete<amrex::Real[]>());
+                    std::copy_n(fab.dataPtr(icomp), local_box.numPts(), data_staged.get());
+                    component.store_chunks.emplace_back(
+                        [data_staged, chunk_offset, chunk_size] (openPMD::MeshRecordComponent& mesh_comp) {
+                            mesh_comp.storeChunk(data_staged, chunk_offset, chunk_size);
+                        });
+                } else {
                     amrex::Real const *local_data = fab.dataPtr(icomp);
-                    mesh_comp.storeChunkRaw(
-                        local_data, chunk_offset, chunk_size);
+                    component.store_chunks.emplace_back(
+                        [local_data, chunk_offset, chunk_size] (openPMD::MeshRecordComponent& mesh_comp) {
+                            mesh_comp.storeChunkRaw(local_data, chunk_offset, chunk_size);
+                        });
                 }
             }
-        } // icomp store loop
+        } // icomp prepare loop
+    } // levels loop (i)
 
 #ifdef AMREX_USE_GPU
-        amrex::Gpu::streamSynchronize();
+    amrex::Gpu::streamSynchronize();
 #endif
-        // Flush data to disk after looping over all components
-        m_Series->flush();
-    } // levels loop (i)
+
+    Submit([this, levels = std::move(levels), iteration, current_step = m_CurrentStep, time, isBTD] () {
+        if (m_Series == nullptr) { throw std::runtime_error("series must be initialized"); }
+
+        // is this either a regular write (true) or the first write in a
+        // backtransformed diagnostic (BTD):
+        bool const first_write_to_iteration = ! m_Series->iterations.contains( iteration );
+
+        // meta data
+        openPMD::Iteration series_iteration = GetIteration(current_step, isBTD);
+
+        // collective open
+        series_iteration.open();
+
+        auto meshes = series_iteration.meshes;
+        if (first_write_to_iteration) {
+            // lets see whether full_geom varies from geom[0]   xgeom[1]
+            series_iteration.setTime( time );
+        }
+
+        for (int lev=0; lev < static_cast<int>(levels.size()); lev++) {
+            MeshLevel const& level = levels[lev];
+            amrex::Geometry full_geom = level.full_geom;
+
+            // setup is called once. So it uses property "period" from first
+            // geometry for <all> field levels.
+            if ( (0 == lev) && first_write_to_iteration ) {
+                SetupFields(meshes, full_geom);
+            }
+
+            if ( first_write_to_iteration )
+            {
+                for (MeshComponent const& component : level.components) {
+                    std::string const& field_name = component.field_name;
+                    std::string const& comp_name = component.comp_name;
+                    if (comp_name == openPMD::MeshRecordComponent::SCALAR) {
+                        if ( ! meshes.contains(field_name) ) {
+                            auto mesh = meshes[field_name];
+                            SetupMeshComp(  mesh,
+                                            full_geom,
+                                            comp_name,
+                                            field_name,
+                                            level.relative_cell_pos,
+                                            component.var_in_theta_mode );
+                        }
+                    } else {
+                        auto mesh = meshes[field_name];
+                        if ( ! mesh.contains(comp_name) ) {
+                            SetupMeshComp(  mesh,
+                                            full_geom,
+                                            comp_name,
+                                            field_name,
+                                            level.relative_cell_pos,
+                                            component.var_in_theta_mode );
+                        }
+                    }
+                }
+            } // component setup loop
+
+            for (MeshComponent const& component : level.components) {
+                auto mesh = meshes[component.field_name];
+                auto mesh_comp = mesh[component.comp_name];
+                for (auto const& store_chunk : component.store_chunks) {
+                    store_chunk(mesh_comp);
+                }
+            } // component store loop
+
+            // Flush data to disk after looping over all components
+            m_Series->flush();
+        } // levels loop (i)
+    });
 }
 #endif // WARPX_USE_OPENPMD
 
@@ -24,6 +24,7 @@
 #   endif
 #endif
 #include "Parallelization/GuardCellManager.H"
+#include "Particles/Deposition/DepositionTiles.H"
 #include "Particles/MultiParticleContainer.H"
 #include "Fluids/MultiFluidContainer.H"
 #include "Fluids/WarpXFluidContainer.H"
@@ -177,8 +178,7 @@ WarpX::Evolve (int numsteps)
         if (evolve_scheme == EvolveScheme::Explicit) {
             if (cur_time + dt[0] >= stop_time - 1.e-3*dt[0] || step == numsteps_max-1) {
                 // At the end of last step, push p by 0.5*dt to synchronize
-                FillBoundaryE(guard_cells.ng_FieldGather);
-                FillBoundaryB(guard_cells.ng_FieldGather);
+                FillBoundaryEB(guard_cells.ng_FieldGather);
                 if (fft_do_time_averaging)
                 {
                     FillBoundaryE_avg(guard_cells.ng_FieldGather);
@@ -305,6 +305,12 @@ WarpX::Evolve (int numsteps)
         }
     } // End loop on time steps
 
+    // Complete the reduced diags of the last step, if their reductions are deferred,
+    // and write the output of the reduced diags buffered in memory
+    if (reduced_diags->m_plot_rd != 0) { reduced_diags->Flush(); }
+
+    if (verbose) { mypc->PrintCollisionScratchStatistics(); }
+
     // This if statement is needed for PICMI, which allows the Evolve routine to be
     // called multiple times, otherwise diagnostics will be done at every call,
     // regardless of the diagnostic period parameter provided in the inputs.
@@ -375,8 +381,7 @@ WarpX::OneStep_nosub (Real cur_time)
             FillBoundaryE(guard_cells.ng_afterPushPSATD, WarpX::sync_nodal_points);
         }
         else {
-            FillBoundaryE(guard_cells.ng_afterPushPSATD, WarpX::sync_nodal_points);
-            FillBoundaryB(guard_cells.ng_afterPushPSATD, WarpX::sync_nodal_points);
+            FillBoundaryEB(guard_cells.ng_afterPushPSATD, WarpX::sync_nodal_points);
             if (WarpX::do_dive_cleaning || WarpX::do_pml_dive_cleaning) {
                 FillBoundaryF(guard_cells.ng_alloc_F, WarpX::sync_nodal_points);
             }
@@ -410,8 +415,7 @@ WarpX::OneStep_nosub (Real cur_time)
 
         if (do_pml) {
             DampPML();
-            FillBoundaryE(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
-            FillBoundaryB(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
+            FillBoundaryEB(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
             FillBoundaryF(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
             FillBoundaryG(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
         }
@@ -453,8 +457,7 @@ void WarpX::ExplicitFillBoundaryEBUpdateAux ()
 
     if (is_synchronized) {
         // Not called at each iteration, so exchange all guard cells
-        FillBoundaryE(guard_cells.ng_alloc_EB);
-        FillBoundaryB(guard_cells.ng_alloc_EB);
+        FillBoundaryEB(guard_cells.ng_alloc_EB);
 
         UpdateAuxilaryData();
         FillBoundaryAux(guard_cells.ng_UpdateAux);
@@ -474,8 +477,7 @@ void WarpX::ExplicitFillBoundaryEBUpdateAux ()
         // Need to update Aux on lower levels, to interpolate to higher levels.
 
         // E and B are up-to-date inside the domain only
-        FillBoundaryE(guard_cells.ng_FieldGather);
-        FillBoundaryB(guard_cells.ng_FieldGather);
+        FillBoundaryEB(guard_cells.ng_FieldGather);
         if (electrostatic_solver_id == ElectrostaticSolverAlgo::None) {
             if (fft_do_time_averaging)
             {
@@ -583,7 +585,16 @@ void WarpX::SyncCurrentAndRho ()
     }
     else // FDTD
     {
-        SyncCurrent(current_fp, current_cp, current_buf);
+        if (m_current_sum_in_flight)
+        {
+            // The summation of the guard cells was started during the deposition
+            // (warpx.do_overlap_current_sum, single level only)
+            SumBoundaryJ_finish(0);
+        }
+        else
+        {
+            SyncCurrent(current_fp, current_cp, current_buf);
+        }
         SyncRho(rho_fp, rho_cp, charge_buf);
     }
 
@@ -762,8 +773,7 @@ WarpX::OneStep_multiJ (const amrex::Real cur_time)
     }
 
     // Exchange guard cells and synchronize nodal points
-    FillBoundaryE(guard_cells.ng_alloc_EB, WarpX::sync_nodal_points);
-    FillBoundaryB(guard_cells.ng_alloc_EB, WarpX::sync_nodal_points);
+    FillBoundaryEB(guard_cells.ng_alloc_EB, WarpX::sync_nodal_points);
     if (WarpX::do_dive_cleaning || WarpX::do_pml_dive_cleaning) {
         FillBoundaryF(guard_cells.ng_alloc_F, WarpX::sync_nodal_points);
     }
@@ -1024,15 +1034,31 @@ WarpX::PushParticlesandDeposit (int lev, amrex::Real cur_time, DtType a_dt_type,
         current_z = current_fp[lev][2].get();
     }
 
-    mypc->Evolve(lev,
-                 *Efield_aux[lev][0], *Efield_aux[lev][1], *Efield_aux[lev][2],
-                 *Bfield_aux[lev][0], *Bfield_aux[lev][1], *Bfield_aux[lev][2],
-                 *current_x, *current_y, *current_z,
-                 current_buf[lev][0].get(), current_buf[lev][1].get(), current_buf[lev][2].get(),
-                 rho_fp[lev].get(), charge_buf[lev].get(),
-                 Efield_cax[lev][0].get(), Efield_cax[lev][1].get(), Efield_cax[lev][2].get(),
-                 Bfield_cax[lev][0].get(), Bfield_cax[lev][1].get(), Bfield_cax[lev][2].get(),
-                 cur_time, dt[lev], a_dt_type, skip_current, push_type);
+    auto evolve_particles = [&] (DepositionTiles tiles) {
+        mypc->Evolve(lev,
+                     *Efield_aux[lev][0], *Efield_aux[lev][1], *Efield_aux[lev][2],
+                     *Bfield_aux[lev][0], *Bfield_aux[lev][1], *Bfield_aux[lev][2],
+                     *current_x, *current_y, *current_z,
+                     current_buf[lev][0].get(), current_buf[lev][1].get(), current_buf[lev][2].get(),
+                     rho_fp[lev].get(), charge_buf[lev].get(),
+                     Efield_cax[lev][0].get(), Efield_cax[lev][1].get(), Efield_cax[lev][2].get(),
+                     Bfield_cax[lev][0].get(), Bfield_cax[lev][1].get(), Bfield_cax[lev][2].get(),
+                     cur_time, dt[lev], a_dt_type, skip_current, push_type, tiles);
+    };
+
+    if (OverlapCurrentSum(skip_current))
+    {
+        // Deposit the tiles near the boundaries of the boxes first, and sum the
+        // guard cells of the current while the interior tiles are deposited.
+        // The summation is completed in SyncCurrentAndRho.
+        evolve_particles(DepositionTiles::Boundary);
+        SumBoundaryJ_nowait(lev);
+        evolve_particles(DepositionTiles::Interior);
+    }
+    else
+    {
+        evolve_particles(DepositionTiles::All);
+    }
     if (! skip_current) {
 #ifdef WARPX_DIM_RZ
         // This is called after all particles have deposited their current and charge.
@@ -35,6 +35,64 @@ void ElectrostaticSolver::ReadParameters () {
     utils::parser::queryWithParser(
         pp_warpx, "self_fields_max_iters", self_fields_max_iters);
     pp_warpx.query("self_fields_verbosity", self_fields_verbosity);
+    pp_warpx.query("self_fields_cache_operator", self_fields_cache_operator);
+    pp_warpx.query_enum_sloppy("self_fields_initial_guess", self_fields_initial_guess, "-_");
+
+    ParmParse const pp_ablastr("ablastr");
+    pp_ablastr.query("igf_distributed_fft", igf_distributed_fft);
+}
+
+void
+ElectrostaticSolver::setPhiInitialGuess (
+    amrex::Vector<std::unique_ptr<amrex::MultiFab>>& phi
+)
+{
+    if (self_fields_initial_guess == PoissonInitialGuess::Previous) { return; }
+
+    if (self_fields_initial_guess == PoissonInitialGuess::Zero) {
+        for (int lev=0; lev < num_levels; lev++) {
+            phi[lev]->setVal(0.);
+        }
+        return;
+    }
+
+    // Extrapolate linearly from the potentials of the two previous solves
+    m_phi_history.resize(num_levels);
+    for (int lev=0; lev < num_levels; lev++) {
+        auto& phi_old = m_phi_history[lev];
+        if (!phi_old || !amrex::isMFIterSafe(*phi[lev], *phi_old)) {
+            // No history yet: start from the previous potential
+            phi_old = std::make_unique<MultiFab>(phi[lev]->boxArray(), phi[lev]->DistributionMap(),
+                                                 phi[lev]->nComp(), phi[lev]->nGrowVect());
+            MultiFab::Copy(*phi_old, *phi[lev], 0, 0, phi[lev]->nComp(), phi[lev]->nGrowVect());
+            continue;
+        }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for ( MFIter mfi(*phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+            auto phi_arr = phi[lev]->array(mfi);
+            auto phi_old_arr = phi_old->array(mfi);
+            const Box& tb = mfi.growntilebox();
+            const int ncomp = phi[lev]->nComp();
+            amrex::ParallelFor( tb, ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) {
+                    // phi_old holds the potential at n-1, phi at n
+                    const amrex::Real phi_n = phi_arr(i,j,k,n);
+                    phi_arr(i,j,k,n) = 2._rt*phi_n - phi_old_arr(i,j,k,n);
+                    phi_old_arr(i,j,k,n) = phi_n;
+                }
+            );
+        }
+    }
+}
+
+void
+ElectrostaticSolver::ResetSolverCache ()
+{
+    m_mlmg_cache.clear();
+    m_phi_history.clear();
 }
 
 void
@@ -116,7 +174,7 @@ ElectrostaticSolver::computePhi (const amrex::Vector<std::unique_ptr<amrex::Mult
                    Real const required_precision,
                    Real absolute_tolerance,
                    int const max_iters,
-                   int const verbosity) const {
+                   int const verbosity) {
     // create a vector to our fields, sorted by level
     amrex::Vector<amrex::MultiFab *> sorted_rho;
     amrex::Vector<amrex::MultiFab *> sorted_phi;
@@ -200,7 +258,9 @@ ElectrostaticSolver::computePhi (const amrex::Vector<std::unique_ptr<amrex::Mult
         warpx.refRatio(),
         post_phi_calculation,
         warpx.gett_new(0),
-        eb_farray_box_factory
+        eb_farray_box_factory,
+        self_fields_cache_operator ? &m_mlmg_cache : nullptr,
+        igf_distributed_fft
     );
 
 }
@@ -56,6 +56,9 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
     // Todo: use simpler finite difference form with beta=0
     const std::array<Real, 3> beta = {0._rt};
 
+    // start the iterative solver from the requested initial guess
+    setPhiInitialGuess(phi_fp);
+
     // set the boundary potentials appropriately
     setPhiBC(phi_fp, warpx.gett_new(0));
 
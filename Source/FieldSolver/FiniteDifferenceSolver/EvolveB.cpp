@@ -106,7 +106,7 @@ void FiniteDifferenceSolver::EvolveBCartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Bfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -182,7 +182,7 @@ void FiniteDifferenceSolver::EvolveBCartesian (
             );
         }
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -220,7 +220,7 @@ void FiniteDifferenceSolver::EvolveBCartesianECT (
 #endif
     for (MFIter mfi(*Bfield[0]); mfi.isValid(); ++mfi) {
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers) {
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic) {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
@@ -342,7 +342,7 @@ void FiniteDifferenceSolver::EvolveBCartesianECT (
             });
 
         }
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -370,7 +370,7 @@ void FiniteDifferenceSolver::EvolveBCylindrical (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Bfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -463,7 +463,7 @@ void FiniteDifferenceSolver::EvolveBCylindrical (
 
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
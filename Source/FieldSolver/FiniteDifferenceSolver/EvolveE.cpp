@@ -109,7 +109,7 @@ void FiniteDifferenceSolver::EvolveECartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -210,7 +210,7 @@ void FiniteDifferenceSolver::EvolveECartesian (
 
         }
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -242,7 +242,7 @@ void FiniteDifferenceSolver::EvolveECylindrical (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -433,7 +433,7 @@ void FiniteDifferenceSolver::EvolveECylindrical (
 
         } // end of if condition for F
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
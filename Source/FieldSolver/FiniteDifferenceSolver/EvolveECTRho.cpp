@@ -85,7 +85,7 @@ void FiniteDifferenceSolver::EvolveRhoCartesianECT (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for (amrex::MFIter mfi(*ECTRhofield[0], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers) {
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic) {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
@@ -146,7 +146,7 @@ void FiniteDifferenceSolver::EvolveRhoCartesianECT (
             }
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
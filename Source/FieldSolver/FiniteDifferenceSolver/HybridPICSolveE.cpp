@@ -78,7 +78,7 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCylindrical (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Jfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -229,7 +229,7 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCylindrical (
             }
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<Real>(amrex::second()) - wt;
@@ -261,7 +261,7 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Jfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers) {
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic) {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
@@ -339,7 +339,7 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCartesian (
             }
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -458,7 +458,7 @@ void FiniteDifferenceSolver::HybridPICSolveECylindrical (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(enE_nodal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -511,7 +511,7 @@ void FiniteDifferenceSolver::HybridPICSolveECylindrical (
             );
         });
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<Real>(amrex::second()) - wt;
@@ -525,7 +525,7 @@ void FiniteDifferenceSolver::HybridPICSolveECylindrical (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -691,7 +691,7 @@ void FiniteDifferenceSolver::HybridPICSolveECylindrical (
             }
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<Real>(amrex::second()) - wt;
@@ -767,7 +767,7 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(enE_nodal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -820,7 +820,7 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
             );
         });
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -834,7 +834,7 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -997,7 +997,7 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
             }
         );
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
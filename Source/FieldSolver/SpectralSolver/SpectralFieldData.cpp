@@ -8,9 +8,12 @@
 #include "SpectralFieldData.H"
 
 #include "Utils/WarpXAlgorithmSelection.H"
+#include "Utils/TextMsg.H"
 #include "Utils/WarpXUtil.H"
 #include "WarpX.H"
 
+#include <ablastr/utils/counters/Counters.H>
+
 #include <AMReX_Array4.H>
 #include <AMReX_BLassert.H>
 #include <AMReX_Box.H>
@@ -123,7 +126,8 @@ SpectralFieldData::SpectralFieldData( const int lev,
                                       const amrex::DistributionMapping& dm,
                                       const int n_field_required,
                                       const bool periodic_single_box):
-    m_periodic_single_box{periodic_single_box}
+    m_periodic_single_box{periodic_single_box},
+    m_batch_fft{WarpX::fft_batch_vector_fields}
 {
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, realspace_ba, dm);
@@ -136,8 +140,10 @@ SpectralFieldData::SpectralFieldData( const int lev,
 
     // Allocate temporary arrays - in real space and spectral space
     // These arrays will store the data just before/after the FFT
-    tmpRealField = MultiFab(realspace_ba, dm, 1, 0);
-    tmpSpectralField = SpectralField(spectralspace_ba, dm, 1, 0);
+    // (one component per field of a batched FFT, if batched FFTs are used)
+    const int n_tmp_comps = m_batch_fft ? max_batch_size : 1;
+    tmpRealField = MultiFab(realspace_ba, dm, n_tmp_comps, 0);
+    tmpSpectralField = SpectralField(spectralspace_ba, dm, n_tmp_comps, 0);
 
     // By default, we assume the FFT is done from/to a nodal grid in real space
     // If the FFT is performed from/to a cell-centered grid in real space,
@@ -162,6 +168,10 @@ SpectralFieldData::SpectralFieldData( const int lev,
     // Allocate and initialize the FFT plans
     forward_plan = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm);
     backward_plan = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm);
+    if (m_batch_fft) {
+        forward_plan_batch = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm);
+        backward_plan_batch = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm);
+    }
     // Loop over boxes and allocate the corresponding plan
     // for each box owned by the local MPI proc
     for ( MFIter mfi(spectralspace_ba, dm); mfi.isValid(); ++mfi ){
@@ -186,6 +196,19 @@ SpectralFieldData::SpectralFieldData( const int lev,
             reinterpret_cast<ablastr::math::anyfft::Complex*>( tmpSpectralField[mfi].dataPtr()),
             ablastr::math::anyfft::direction::C2R, AMREX_SPACEDIM);
 
+        // Batched plans, which transform all the components of the temporary arrays at once
+        if (m_batch_fft) {
+            forward_plan_batch[mfi] = ablastr::math::anyfft::CreatePlan(
+                fft_size, tmpRealField[mfi].dataPtr(),
+                reinterpret_cast<ablastr::math::anyfft::Complex*>( tmpSpectralField[mfi].dataPtr()),
+                ablastr::math::anyfft::direction::R2C, AMREX_SPACEDIM, max_batch_size);
+
+            backward_plan_batch[mfi] = ablastr::math::anyfft::CreatePlan(
+                fft_size, tmpRealField[mfi].dataPtr(),
+                reinterpret_cast<ablastr::math::anyfft::Complex*>( tmpSpectralField[mfi].dataPtr()),
+                ablastr::math::anyfft::direction::C2R, AMREX_SPACEDIM, max_batch_size);
+        }
+
         if (do_costs)
         {
             amrex::Gpu::synchronize();
@@ -202,6 +225,10 @@ SpectralFieldData::~SpectralFieldData()
         for ( MFIter mfi(tmpRealField); mfi.isValid(); ++mfi ){
             ablastr::math::anyfft::DestroyPlan(forward_plan[mfi]);
             ablastr::math::anyfft::DestroyPlan(backward_plan[mfi]);
+            if (m_batch_fft) {
+                ablastr::math::anyfft::DestroyPlan(forward_plan_batch[mfi]);
+                ablastr::math::anyfft::DestroyPlan(backward_plan_batch[mfi]);
+            }
         }
     }
 }
@@ -214,55 +241,89 @@ SpectralFieldData::ForwardTransform (const int lev,
                                      const MultiFab& mf, const int field_index,
                                      const int i_comp)
 {
+    ForwardTransform(lev, amrex::Vector<const MultiFab*>{&mf}, {field_index}, {i_comp});
+}
+
+/* \brief Transform the components `i_comp` of the MultiFabs `mf`
+ *  to spectral space, and store the corresponding results internally
+ *  (in the spectral fields specified by `field_index`) */
+void
+SpectralFieldData::ForwardTransform (const int lev,
+                                     const amrex::Vector<const MultiFab*>& mf,
+                                     const amrex::Vector<int>& field_index,
+                                     const amrex::Vector<int>& i_comp)
+{
+    const auto n_batch = static_cast<int>(mf.size());
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        static_cast<int>(field_index.size()) == n_batch && static_cast<int>(i_comp.size()) == n_batch,
+        "SpectralFieldData::ForwardTransform: mf, field_index and i_comp must have the same size");
+
+    // The FFT plans transform either one component or max_batch_size components:
+    // any other number of components (or all of them, without batched plans)
+    // is transformed one component at a time
+    if (n_batch != 1 && (n_batch != max_batch_size || !m_batch_fft)) {
+        for (int n = 0; n < n_batch; ++n) {
+            ForwardTransform(lev, amrex::Vector<const MultiFab*>{mf[n]}, {field_index[n]}, {i_comp[n]});
+        }
+        return;
+    }
+    ablastr::math::anyfft::FFTplans& plan = (n_batch == 1) ? forward_plan : forward_plan_batch;
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
-    const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, mf.boxArray(), mf.DistributionMap());
+    const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, mf[0]->boxArray(), mf[0]->DistributionMap());
 
     // Check field index type, in order to apply proper shift in spectral space
-    const bool is_nodal_0 = mf.is_nodal(0);
-#if AMREX_SPACEDIM > 1
-    const bool is_nodal_1 = mf.is_nodal(1);
-#if AMREX_SPACEDIM > 2
-    const bool is_nodal_2 = mf.is_nodal(2);
-#endif
-#endif
+    amrex::GpuArray<amrex::IntVect, max_batch_size> is_nodal{};
+    amrex::GpuArray<int, max_batch_size> field_idx{};
+    amrex::GpuArray<int, max_batch_size> comp{};
+    for (int n = 0; n < n_batch; ++n) {
+        is_nodal[n] = mf[n]->ixType().toIntVect();
+        field_idx[n] = field_index[n];
+        comp[n] = i_comp[n];
+    }
 
     // Loop over boxes
     // Note: we do NOT OpenMP parallelize here, since we use OpenMP threads for
     //       the FFTs on each box!
-    for ( MFIter mfi(mf); mfi.isValid(); ++mfi ){
+    for ( MFIter mfi(*mf[0]); mfi.isValid(); ++mfi ){
         if (do_costs)
         {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
 
-        // Copy the real-space field `mf` to the temporary field `tmpRealField`
+        // Copy the real-space fields `mf` to the temporary field `tmpRealField`
+        // (one component per field)
         // This ensures that all fields have the same number of points
         // before the Fourier transform.
         // As a consequence, the copy discards the *last* point of `mf`
         // in any direction that has *nodal* index type.
         {
-            Box realspace_bx;
-            if (m_periodic_single_box) {
-                realspace_bx = mfi.validbox(); // Discard guard cells
-            } else {
-                realspace_bx = mf[mfi].box(); // Keep guard cells
+            amrex::GpuArray<Array4<const Real>, max_batch_size> mf_arr;
+            for (int n = 0; n < n_batch; ++n) {
+                Box realspace_bx;
+                if (m_periodic_single_box) {
+                    realspace_bx = mf[n]->box(mfi.index()); // Discard guard cells
+                } else {
+                    realspace_bx = (*mf[n])[mfi].box(); // Keep guard cells
+                }
+                realspace_bx.enclosedCells(); // Discard last point in nodal direction
+                AMREX_ALWAYS_ASSERT( realspace_bx.contains(tmpRealField[mfi].box()) );
+                mf_arr[n] = mf[n]->const_array(mfi);
             }
-            realspace_bx.enclosedCells(); // Discard last point in nodal direction
-            AMREX_ALWAYS_ASSERT( realspace_bx.contains(tmpRealField[mfi].box()) );
-            const Array4<const Real> mf_arr = mf[mfi].array();
             const Array4<Real> tmp_arr = tmpRealField[mfi].array();
-            ParallelFor( tmpRealField[mfi].box(),
-            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                tmp_arr(i,j,k) = mf_arr(i,j,k,i_comp);
+            ParallelFor( tmpRealField[mfi].box(), n_batch,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                tmp_arr(i,j,k,n) = mf_arr[n](i,j,k,comp[n]);
             });
         }
 
         // Perform Fourier transform from `tmpRealField` to `tmpSpectralField`
-        ablastr::math::anyfft::Execute(forward_plan[mfi]);
+        ablastr::math::anyfft::Execute(plan[mfi]);
 
         // Copy the spectral-space field `tmpSpectralField` to the appropriate
-        // index of the FabArray `fields` (specified by `field_index`)
+        // indices of the FabArray `fields` (specified by `field_index`)
         // and apply correcting shift factor if the real space data comes
         // from a cell-centered grid in real space instead of a nodal grid.
         {
@@ -279,19 +340,19 @@ SpectralFieldData::ForwardTransform (const int lev,
             // Loop over indices within one box
             const Box spectralspace_bx = tmpSpectralField[mfi].box();
 
-            ParallelFor( spectralspace_bx,
-            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                Complex spectral_field_value = tmp_arr(i,j,k);
+            ParallelFor( spectralspace_bx, n_batch,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                Complex spectral_field_value = tmp_arr(i,j,k,n);
                 // Apply proper shift in each dimension
-                if (!is_nodal_0) { spectral_field_value *= shift0_arr[i]; }
+                if (!is_nodal[n][0]) { spectral_field_value *= shift0_arr[i]; }
 #if AMREX_SPACEDIM > 1
-                if (!is_nodal_1) { spectral_field_value *= shift1_arr[j]; }
+                if (!is_nodal[n][1]) { spectral_field_value *= shift1_arr[j]; }
 #if AMREX_SPACEDIM > 2
-                if (!is_nodal_2) { spectral_field_value *= shift2_arr[k]; }
+                if (!is_nodal[n][2]) { spectral_field_value *= shift2_arr[k]; }
 #endif
 #endif
                 // Copy field into the right index
-                fields_arr(i,j,k,field_index) = spectral_field_value;
+                fields_arr(i,j,k,field_idx[n]) = spectral_field_value;
             });
         }
 
@@ -314,29 +375,60 @@ SpectralFieldData::BackwardTransform (const int lev,
                                       const amrex::IntVect& fill_guards,
                                       const int i_comp)
 {
+    BackwardTransform(lev, amrex::Vector<MultiFab*>{&mf}, {field_index}, fill_guards, {i_comp});
+}
+
+/* \brief Transform spectral fields specified by `field_index` back to
+ * real space, and store them in the components `i_comp` of the MultiFabs `mf` */
+void
+SpectralFieldData::BackwardTransform (const int lev,
+                                      const amrex::Vector<MultiFab*>& mf,
+                                      const amrex::Vector<int>& field_index,
+                                      const amrex::IntVect& fill_guards,
+                                      const amrex::Vector<int>& i_comp)
+{
+    const auto n_batch = static_cast<int>(mf.size());
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        static_cast<int>(field_index.size()) == n_batch && static_cast<int>(i_comp.size()) == n_batch,
+        "SpectralFieldData::BackwardTransform: mf, field_index and i_comp must have the same size");
+
+    // The FFT plans transform either one component or max_batch_size components:
+    // any other number of components (or all of them, without batched plans)
+    // is transformed one component at a time
+    if (n_batch != 1 && (n_batch != max_batch_size || !m_batch_fft)) {
+        for (int n = 0; n < n_batch; ++n) {
+            BackwardTransform(lev, amrex::Vector<MultiFab*>{mf[n]}, {field_index[n]}, fill_guards, {i_comp[n]});
+        }
+        return;
+    }
+    ablastr::math::anyfft::FFTplans& plan = (n_batch == 1) ? backward_plan : backward_plan_batch;
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
-    const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, mf.boxArray(), mf.DistributionMap());
+    const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, mf[0]->boxArray(), mf[0]->DistributionMap());
 
     // Check field index type, in order to apply proper shift in spectral space
-    const bool is_nodal_0 = mf.is_nodal(0);
-    const bool is_nodal_1 = (AMREX_SPACEDIM > 1 ? mf.is_nodal(1) : 0);
-    const bool is_nodal_2 = (AMREX_SPACEDIM > 2 ? mf.is_nodal(2) : 0);
-
-    // Numbers of guard cells
-    const amrex::IntVect& mf_ng = mf.nGrowVect();
+    amrex::GpuArray<amrex::IntVect, max_batch_size> is_nodal{};
+    amrex::GpuArray<int, max_batch_size> field_idx{};
+    amrex::GpuArray<int, max_batch_size> comp{};
+    for (int n = 0; n < n_batch; ++n) {
+        is_nodal[n] = mf[n]->ixType().toIntVect();
+        field_idx[n] = field_index[n];
+        comp[n] = i_comp[n];
+    }
 
     // Loop over boxes
     // Note: we do NOT OpenMP parallelize here, since we use OpenMP threads for
     //       the iFFTs on each box!
-    for ( MFIter mfi(mf); mfi.isValid(); ++mfi ){
+    for ( MFIter mfi(*mf[0]); mfi.isValid(); ++mfi ){
         if (do_costs)
         {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
 
-        // Copy the spectral-space field `tmpSpectralField` to the appropriate
-        // field (specified by the input argument field_index)
+        // Copy the spectral-space fields (specified by the input argument field_index)
+        // to the temporary field `tmpSpectralField` (one component per field)
         // and apply correcting shift factor if the field is to be transformed
         // to a cell-centered grid in real space instead of a nodal grid.
         {
@@ -352,70 +444,76 @@ SpectralFieldData::BackwardTransform (const int lev,
             // Loop over indices within one box
             const Box spectralspace_bx = tmpSpectralField[mfi].box();
 
-            ParallelFor( spectralspace_bx,
-            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                Complex spectral_field_value = field_arr(i,j,k,field_index);
+            ParallelFor( spectralspace_bx, n_batch,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                Complex spectral_field_value = field_arr(i,j,k,field_idx[n]);
                 // Apply proper shift in each dimension
-                if (!is_nodal_0) { spectral_field_value *= shift0_arr[i]; }
+                if (!is_nodal[n][0]) { spectral_field_value *= shift0_arr[i]; }
 #if AMREX_SPACEDIM > 1
-                if (!is_nodal_1) { spectral_field_value *= shift1_arr[j]; }
+                if (!is_nodal[n][1]) { spectral_field_value *= shift1_arr[j]; }
 #if AMREX_SPACEDIM > 2
-                if (!is_nodal_2) { spectral_field_value *= shift2_arr[k]; }
+                if (!is_nodal[n][2]) { spectral_field_value *= shift2_arr[k]; }
 #endif
 #endif
                 // Copy field into temporary array
-                tmp_arr(i,j,k) = spectral_field_value;
+                tmp_arr(i,j,k,n) = spectral_field_value;
             });
         }
 
         // Perform Fourier transform from `tmpSpectralField` to `tmpRealField`
-        ablastr::math::anyfft::Execute(backward_plan[mfi]);
+        ablastr::math::anyfft::Execute(plan[mfi]);
 
-        // Copy the temporary field tmpRealField to the real-space field mf and
+        // Copy the temporary field tmpRealField to the real-space fields mf and
         // normalize, dividing by N, since (FFT + inverse FFT) results in a factor N
         {
-            amrex::Box mf_box = (m_periodic_single_box) ? mfi.validbox() : mfi.fabbox();
-            const amrex::Array4<amrex::Real> mf_arr = mf[mfi].array();
-            const amrex::Array4<const amrex::Real> tmp_arr = tmpRealField[mfi].array();
-
-            const amrex::Real inv_N = 1._rt / tmpRealField[mfi].box().numPts();
-
-            // Total number of cells, including ghost cells (nj represents ny in 3D and nz in 2D)
-            const int ni = mf_box.length(0);
-            const int nj = (AMREX_SPACEDIM > 1 ? mf_box.length(1) : 1);
-            const int nk = (AMREX_SPACEDIM > 2 ? mf_box.length(2) : 1);
-
-            const int si = (is_nodal_0) ? 1 : 0;
-            const int sj = (is_nodal_1) ? 1 : 0;
-            const int sk = (is_nodal_2) ? 1 : 0;
-
-            // Lower bound of the box (lo_j represents lo_y in 3D and lo_z in 2D)
-            const int lo_i = amrex::lbound(mf_box).x;
-            const int lo_j = (AMREX_SPACEDIM > 1 ? amrex::lbound(mf_box).y : 0);
-            const int lo_k = (AMREX_SPACEDIM > 2 ? amrex::lbound(mf_box).z : 0);
-
-            // If necessary, do not fill the guard cells
-            // (shrink box by passing negative number of cells)
-            if (!m_periodic_single_box)
-            {
-                for (int dir = 0; dir < AMREX_SPACEDIM; dir++)
+            amrex::GpuArray<amrex::Array4<amrex::Real>, max_batch_size> mf_arr;
+            // Full box of each field, including ghost cells, and box that is filled
+            // (the boxes are converted to cell-centered index type, in order to
+            // loop over all the fields at once over the union of these boxes)
+            amrex::GpuArray<amrex::Box, max_batch_size> full_box;
+            amrex::GpuArray<amrex::Box, max_batch_size> fill_box;
+            amrex::Box loop_box;
+            for (int n = 0; n < n_batch; ++n) {
+                const amrex::Box mf_box = (m_periodic_single_box) ?
+                    mf[n]->box(mfi.index()) : (*mf[n])[mfi].box();
+                full_box[n] = amrex::Box(mf_box.smallEnd(), mf_box.bigEnd());
+                fill_box[n] = full_box[n];
+
+                // If necessary, do not fill the guard cells
+                // (shrink box by passing negative number of cells)
+                if (!m_periodic_single_box)
                 {
-                    if ((fill_guards[dir]) == 0) { mf_box.grow(dir, -mf_ng[dir]); }
+                    const amrex::IntVect& mf_ng = mf[n]->nGrowVect();
+                    for (int dir = 0; dir < AMREX_SPACEDIM; dir++)
+                    {
+                        if ((fill_guards[dir]) == 0) { fill_box[n].grow(dir, -mf_ng[dir]); }
+                    }
                 }
+                loop_box = (n == 0) ? fill_box[n] : amrex::minBox(loop_box, fill_box[n]);
+                mf_arr[n] = mf[n]->array(mfi);
             }
+            const amrex::Array4<const amrex::Real> tmp_arr = tmpRealField[mfi].array();
 
-            // Loop over cells within full box, including ghost cells
-            ParallelFor(mf_box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            const amrex::Real inv_N = 1._rt / tmpRealField[mfi].box().numPts();
+
+            // Loop over cells within the boxes, including ghost cells
+            ParallelFor(loop_box, n_batch, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept
             {
+                const amrex::IntVect iv(AMREX_D_DECL(i,j,k));
+                if (!fill_box[n].contains(iv)) { return; }
                 // Assume periodicity and set the last outer guard cell equal to the first one:
                 // this is necessary in order to get the correct value along a nodal direction,
                 // because the last point along a nodal direction is always discarded when FFTs
                 // are computed, as the real-space box is always cell-centered.
-                const int ii = (i == lo_i + ni - si) ? lo_i : i;
-                const int jj = (j == lo_j + nj - sj) ? lo_j : j;
-                const int kk = (k == lo_k + nk - sk) ? lo_k : k;
+                amrex::IntVect iv_tmp = iv;
+                for (int dir = 0; dir < AMREX_SPACEDIM; dir++)
+                {
+                    if (is_nodal[n][dir] && iv[dir] == full_box[n].bigEnd(dir)) {
+                        iv_tmp[dir] = full_box[n].smallEnd(dir);
+                    }
+                }
                 // Copy and normalize field
-                mf_arr(i,j,k,i_comp) = inv_N * tmp_arr(ii,jj,kk);
+                mf_arr[n](i,j,k,comp[n]) = inv_N * tmp_arr(iv_tmp,n);
             });
         }
 
@@ -10,6 +10,7 @@
 #include "WarpX.H"
 
 #include <ablastr/math/fft/AnyFFT.H>
+#include <ablastr/utils/counters/Counters.H>
 #include <ablastr/warn_manager/WarnManager.H>
 
 #include <AMReX_Config.H>
@@ -452,6 +453,8 @@ SpectralFieldDataRZ::ForwardTransform (const int lev,
                                        amrex::MultiFab const & field_mf, int const field_index,
                                        int const i_comp)
 {
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, field_mf.boxArray(), field_mf.DistributionMap());
 
@@ -512,6 +515,8 @@ SpectralFieldDataRZ::ForwardTransform (const int lev,
                                        amrex::MultiFab const & field_mf_r, int const field_index_r,
                                        amrex::MultiFab const & field_mf_t, int const field_index_t)
 {
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, field_mf_r.boxArray(), field_mf_r.DistributionMap());
 
@@ -577,6 +582,8 @@ SpectralFieldDataRZ::BackwardTransform (const int lev,
                                         amrex::MultiFab& field_mf, int const field_index,
                                         int const i_comp)
 {
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, field_mf.boxArray(), field_mf.DistributionMap());
 
@@ -661,6 +668,8 @@ SpectralFieldDataRZ::BackwardTransform (const int lev,
                                         amrex::MultiFab& field_mf_r, int const field_index_r,
                                         amrex::MultiFab& field_mf_t, int const field_index_t)
 {
+    const ablastr::utils::counters::ScopedTimer fft_timer("fft_time");
+
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     const bool do_costs = WarpXUtilLoadBalance::doCosts(cost, field_mf_r.boxArray(), field_mf_r.DistributionMap());
 
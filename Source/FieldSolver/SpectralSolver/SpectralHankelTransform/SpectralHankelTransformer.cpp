@@ -8,7 +8,32 @@
 
 #include "Utils/WarpXConst.H"
 
+#include <map>
 #include <memory>
+#include <tuple>
+
+namespace
+{
+    /* \brief Returns the Hankel transform of order hankel_order for the azimuthal mode,
+     *  on a radial grid with nr points up to rmax.
+     *  The transforms (and their matrices, which are expensive to compute) are shared
+     *  by all the boxes with the same radial grid, as long as one of them exists. */
+    std::shared_ptr<HankelTransform>
+    getHankelTransform (int const hankel_order, int const azimuthal_mode,
+                        int const nr, amrex::Real const rmax)
+    {
+        using Key = std::tuple<int, int, int, amrex::Real>;
+        static std::map<Key, std::weak_ptr<HankelTransform>> transforms;
+
+        Key const key{hankel_order, azimuthal_mode, nr, rmax};
+        std::shared_ptr<HankelTransform> transform = transforms[key].lock();
+        if (!transform) {
+            transform = std::make_shared<HankelTransform>(hankel_order, azimuthal_mode, nr, rmax);
+            transforms[key] = transform;
+        }
+        return transform;
+    }
+}
 
 SpectralHankelTransformer::SpectralHankelTransformer (int const nr,
                                                       int const n_rz_azimuthal_modes,
@@ -21,9 +46,9 @@ SpectralHankelTransformer::SpectralHankelTransformer (int const nr,
     dhtm.resize(m_n_rz_azimuthal_modes);
 
     for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
-        dht0[mode] = std::make_unique<HankelTransform>(mode  , mode, m_nr, rmax);
-        dhtp[mode] = std::make_unique<HankelTransform>(mode+1, mode, m_nr, rmax);
-        dhtm[mode] = std::make_unique<HankelTransform>(mode-1, mode, m_nr, rmax);
+        dht0[mode] = getHankelTransform(mode  , mode, m_nr, rmax);
+        dhtp[mode] = getHankelTransform(mode+1, mode, m_nr, rmax);
+        dhtm[mode] = getHankelTransform(mode-1, mode, m_nr, rmax);
     }
 
     ExtractKrArray();
@@ -61,8 +86,8 @@ SpectralHankelTransformer::PhysicalToSpectral_Scalar (amrex::FArrayBox const & F
                                                       amrex::FArrayBox       & G_spectral)
 {
     // The Hankel transform is purely real, so the real and imaginary parts of
-    // F can be transformed separately, so a simple loop over components
-    // can be done.
+    // F can be transformed separately, with the same matrix: they are
+    // transformed together, as two consecutive components.
     // Note that F_physical does not include the imaginary part of mode 0,
     // but G_spectral does.
     for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
@@ -74,8 +99,7 @@ SpectralHankelTransformer::PhysicalToSpectral_Scalar (amrex::FArrayBox const & F
             G_spectral.setVal<amrex::RunOn::Device>(0., mode_i);
         } else {
             int const icomp = 2*mode - 1;
-            dht0[mode]->HankelForwardTransform(F_physical, icomp  , G_spectral, mode_r);
-            dht0[mode]->HankelForwardTransform(F_physical, icomp+1, G_spectral, mode_i);
+            dht0[mode]->HankelForwardTransform(F_physical, icomp, G_spectral, mode_r, 2);
         }
     }
 }
@@ -96,34 +120,32 @@ SpectralHankelTransformer::PhysicalToSpectral_Vector (amrex::Box const & box,
     amrex::Array4<amrex::Real> const & F_r_physical_array = F_r_physical.array();
     amrex::Array4<amrex::Real> const & F_t_physical_array = F_t_physical.array();
 
-    for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
-
+    // Combine the components of all the modes at once
+    amrex::ParallelFor(box, m_n_rz_azimuthal_modes,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k, int mode)
+    {
         int const mode_r = 2*mode;
         int const mode_i = 2*mode + 1;
+        amrex::Real const r_real = F_r_physical_array(i,j,k,mode_r);
+        amrex::Real const r_imag = F_r_physical_array(i,j,k,mode_i);
+        amrex::Real const t_real = F_t_physical_array(i,j,k,mode_r);
+        amrex::Real const t_imag = F_t_physical_array(i,j,k,mode_i);
+        // Combine the values
+        // temp_p = (F_r - I*F_t)/2
+        // temp_m = (F_r + I*F_t)/2
+        F_r_physical_array(i,j,k,mode_r) = 0.5_rt*(r_real + t_imag);
+        F_r_physical_array(i,j,k,mode_i) = 0.5_rt*(r_imag - t_real);
+        F_t_physical_array(i,j,k,mode_r) = 0.5_rt*(r_real - t_imag);
+        F_t_physical_array(i,j,k,mode_i) = 0.5_rt*(r_imag + t_real);
+    });
 
-        amrex::ParallelFor(box,
-        [=] AMREX_GPU_DEVICE (int i, int j, int k)
-        {
-            amrex::Real const r_real = F_r_physical_array(i,j,k,mode_r);
-            amrex::Real const r_imag = F_r_physical_array(i,j,k,mode_i);
-            amrex::Real const t_real = F_t_physical_array(i,j,k,mode_r);
-            amrex::Real const t_imag = F_t_physical_array(i,j,k,mode_i);
-            // Combine the values
-            // temp_p = (F_r - I*F_t)/2
-            // temp_m = (F_r + I*F_t)/2
-            F_r_physical_array(i,j,k,mode_r) = 0.5_rt*(r_real + t_imag);
-            F_r_physical_array(i,j,k,mode_i) = 0.5_rt*(r_imag - t_real);
-            F_t_physical_array(i,j,k,mode_r) = 0.5_rt*(r_real - t_imag);
-            F_t_physical_array(i,j,k,mode_i) = 0.5_rt*(r_imag + t_real);
-        });
-
-        amrex::Gpu::streamSynchronize();
-
-        dhtp[mode]->HankelForwardTransform(F_r_physical, mode_r, G_p_spectral, mode_r);
-        dhtp[mode]->HankelForwardTransform(F_r_physical, mode_i, G_p_spectral, mode_i);
-        dhtm[mode]->HankelForwardTransform(F_t_physical, mode_r, G_m_spectral, mode_r);
-        dhtm[mode]->HankelForwardTransform(F_t_physical, mode_i, G_m_spectral, mode_i);
+    amrex::Gpu::streamSynchronize();
 
+    // The real and imaginary parts of each mode are transformed together
+    for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
+        int const mode_r = 2*mode;
+        dhtp[mode]->HankelForwardTransform(F_r_physical, mode_r, G_p_spectral, mode_r, 2);
+        dhtm[mode]->HankelForwardTransform(F_t_physical, mode_r, G_m_spectral, mode_r, 2);
     }
 }
 
@@ -133,8 +155,8 @@ SpectralHankelTransformer::SpectralToPhysical_Scalar (amrex::FArrayBox const & G
                                                       amrex::FArrayBox       & F_physical)
 {
     // The Hankel inverse transform is purely real, so the real and imaginary parts of
-    // F can be transformed separately, so a simple loop over components
-    // can be done.
+    // F can be transformed separately, with the same matrix: they are
+    // transformed together, as two consecutive components.
     // Note that F_physical does not include the imaginary part of mode 0,
     // but G_spectral does.
 
@@ -148,8 +170,7 @@ SpectralHankelTransformer::SpectralToPhysical_Scalar (amrex::FArrayBox const & G
             dht0[mode]->HankelInverseTransform(G_spectral, mode_r, F_physical, icomp);
         } else {
             int const icomp = 2*mode - 1;
-            dht0[mode]->HankelInverseTransform(G_spectral, mode_r, F_physical, icomp);
-            dht0[mode]->HankelInverseTransform(G_spectral, mode_i, F_physical, icomp+1);
+            dht0[mode]->HankelInverseTransform(G_spectral, mode_r, F_physical, icomp, 2);
         }
     }
 }
@@ -167,35 +188,33 @@ SpectralHankelTransformer::SpectralToPhysical_Vector (amrex::Box const & box,
     amrex::Array4<amrex::Real> const & F_r_physical_array = F_r_physical.array();
     amrex::Array4<amrex::Real> const & F_t_physical_array = F_t_physical.array();
 
-    for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
+    amrex::Gpu::streamSynchronize();
 
+    // The real and imaginary parts of each mode are transformed together
+    for (int mode=0 ; mode < m_n_rz_azimuthal_modes ; mode++) {
         int const mode_r = 2*mode;
-        int const mode_i = 2*mode + 1;
-
-        amrex::Gpu::streamSynchronize();
-
-        dhtp[mode]->HankelInverseTransform(G_p_spectral, mode_r, F_r_physical, mode_r);
-        dhtp[mode]->HankelInverseTransform(G_p_spectral, mode_i, F_r_physical, mode_i);
-        dhtm[mode]->HankelInverseTransform(G_m_spectral, mode_r, F_t_physical, mode_r);
-        dhtm[mode]->HankelInverseTransform(G_m_spectral, mode_i, F_t_physical, mode_i);
-
-        amrex::Gpu::streamSynchronize();
+        dhtp[mode]->HankelInverseTransform(G_p_spectral, mode_r, F_r_physical, mode_r, 2);
+        dhtm[mode]->HankelInverseTransform(G_m_spectral, mode_r, F_t_physical, mode_r, 2);
+    }
 
-        amrex::ParallelFor(box,
-        [=] AMREX_GPU_DEVICE (int i, int j, int k)
-        {
-            amrex::Real const p_real = F_r_physical_array(i,j,k,mode_r);
-            amrex::Real const p_imag = F_r_physical_array(i,j,k,mode_i);
-            amrex::Real const m_real = F_t_physical_array(i,j,k,mode_r);
-            amrex::Real const m_imag = F_t_physical_array(i,j,k,mode_i);
-            // Combine the values
-            // F_r =    G_p + G_m
-            // F_t = I*(G_p - G_m)
-            F_r_physical_array(i,j,k,mode_r) =  p_real + m_real;
-            F_r_physical_array(i,j,k,mode_i) =  p_imag + m_imag;
-            F_t_physical_array(i,j,k,mode_r) = -p_imag + m_imag;
-            F_t_physical_array(i,j,k,mode_i) =  p_real - m_real;
-        });
+    amrex::Gpu::streamSynchronize();
 
-    }
+    // Combine the components of all the modes at once
+    amrex::ParallelFor(box, m_n_rz_azimuthal_modes,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k, int mode)
+    {
+        int const mode_r = 2*mode;
+        int const mode_i = 2*mode + 1;
+        amrex::Real const p_real = F_r_physical_array(i,j,k,mode_r);
+        amrex::Real const p_imag = F_r_physical_array(i,j,k,mode_i);
+        amrex::Real const m_real = F_t_physical_array(i,j,k,mode_r);
+        amrex::Real const m_imag = F_t_physical_array(i,j,k,mode_i);
+        // Combine the values
+        // F_r =    G_p + G_m
+        // F_t = I*(G_p - G_m)
+        F_r_physical_array(i,j,k,mode_r) =  p_real + m_real;
+        F_r_physical_array(i,j,k,mode_i) =  p_imag + m_imag;
+        F_t_physical_array(i,j,k,mode_r) = -p_imag + m_imag;
+        F_t_physical_array(i,j,k,mode_i) =  p_real - m_real;
+    });
 }
@@ -140,6 +140,27 @@ SpectralSolver::BackwardTransform( const int lev,
     field_data.BackwardTransform(lev, mf, field_index, fill_guards, i_comp);
 }
 
+void
+SpectralSolver::ForwardTransform (const int lev,
+                                  const amrex::Vector<const amrex::MultiFab*>& mf,
+                                  const amrex::Vector<int>& field_index,
+                                  const amrex::Vector<int>& i_comp)
+{
+    WARPX_PROFILE("SpectralSolver::ForwardTransform");
+    field_data.ForwardTransform(lev, mf, field_index, i_comp);
+}
+
+void
+SpectralSolver::BackwardTransform( const int lev,
+                                   const amrex::Vector<amrex::MultiFab*>& mf,
+                                   const amrex::Vector<int>& field_index,
+                                   const amrex::IntVect& fill_guards,
+                                   const amrex::Vector<int>& i_comp )
+{
+    WARPX_PROFILE("SpectralSolver::BackwardTransform");
+    field_data.BackwardTransform(lev, mf, field_index, fill_guards, i_comp);
+}
+
 void
 SpectralSolver::pushSpectralFields(){
     WARPX_PROFILE("SpectralSolver::pushSpectralFields");
@@ -71,9 +71,10 @@ namespace {
         solver.ForwardTransform(lev, *vector_field[0], compx, *vector_field[1], compy);
         solver.ForwardTransform(lev, *vector_field[2], compz);
 #else
-        solver.ForwardTransform(lev, *vector_field[0], compx);
-        solver.ForwardTransform(lev, *vector_field[1], compy);
-        solver.ForwardTransform(lev, *vector_field[2], compz);
+        // One batched FFT per box for the three components (if psatd.batch_fft)
+        solver.ForwardTransform(lev,
+            {vector_field[0].get(), vector_field[1].get(), vector_field[2].get()},
+            {compx, compy, compz}, {0, 0, 0});
 #endif
     }
 
@@ -93,9 +94,10 @@ namespace {
         solver.BackwardTransform(lev, *vector_field[0], compx, *vector_field[1], compy);
         solver.BackwardTransform(lev, *vector_field[2], compz);
 #else
-        solver.BackwardTransform(lev, *vector_field[0], compx, fill_guards);
-        solver.BackwardTransform(lev, *vector_field[1], compy, fill_guards);
-        solver.BackwardTransform(lev, *vector_field[2], compz, fill_guards);
+        // One batched inverse FFT per box for the three components (if psatd.batch_fft)
+        solver.BackwardTransform(lev,
+            {vector_field[0].get(), vector_field[1].get(), vector_field[2].get()},
+            {compx, compy, compz}, fill_guards, {0, 0, 0});
 #endif
     }
 }
@@ -99,13 +99,12 @@ WarpXLaserProfiles::FromFileLaserProfile::init (
     }
     //Reads the (optional) delay
     utils::parser::queryWithParser(ppl, "delay", m_params.t_delay);
+    //Whether the next time chunk is read in the background
+    ppl.query("prefetch_time_chunks", m_params.prefetch_time_chunks);
 
     //Read first time chunk
-    if (m_params.file_in_lasy_format){
-        read_data_t_chunk(0, m_params.time_chunk_size);
-    } else{
-        read_binary_data_t_chunk(0, m_params.time_chunk_size);
-    }
+    load_t_chunk(0, m_params.time_chunk_size);
+    if (m_params.prefetch_time_chunks) { start_prefetch(); }
     //Copy common params
     m_common_params = params;
 }
@@ -120,16 +119,32 @@ WarpXLaserProfiles::FromFileLaserProfile::update (amrex::Real t)
     const auto idx_times = find_left_right_time_indices(t);
     const auto idx_t_left = idx_times.first;
     const auto idx_t_right = idx_times.second;
+    //Broadcast the prefetched data chunk once half of the current chunk is used,
+    //so that the broadcast overlaps with the second half
+    if (m_next_chunk.first_time_index >= 0 && !m_next_chunk_bcast_started &&
+        2*idx_t_right > m_params.first_time_index + m_params.last_time_index){
+        start_prefetch_bcast();
+    }
     //Load data chunk if needed
     if(idx_t_right >  m_params.last_time_index){
-        if (m_params.file_in_lasy_format){
-            read_data_t_chunk(idx_t_left, idx_t_left+m_params.time_chunk_size);
-        } else{
-            read_binary_data_t_chunk(idx_t_left, idx_t_left+m_params.time_chunk_size);
+        if (!finish_prefetch(idx_t_left, idx_t_right)){
+            load_t_chunk(idx_t_left, idx_t_left+m_params.time_chunk_size);
         }
+        if (m_params.prefetch_time_chunks) { start_prefetch(); }
     }
 }
 
+WarpXLaserProfiles::FromFileLaserProfile::~FromFileLaserProfile ()
+{
+    // the read and the broadcast must be complete before the buffers are freed
+    if (m_next_chunk_read.valid()) { m_next_chunk_read.wait(); }
+#ifdef AMREX_USE_MPI
+    if (m_next_chunk_request != MPI_REQUEST_NULL) {
+        MPI_Wait(&m_next_chunk_request, MPI_STATUS_IGNORE);
+    }
+#endif
+}
+
 void
 WarpXLaserProfiles::FromFileLaserProfile::fill_amplitude (
     const int np,
@@ -309,119 +324,216 @@ WarpXLaserProfiles::FromFileLaserProfile::find_left_right_time_indices(amrex::Re
     return std::make_pair(idx_t_right-1, idx_t_right);
 }
 
+WarpXLaserProfiles::FromFileLaserProfile::TimeChunk
+WarpXLaserProfiles::FromFileLaserProfile::make_t_chunk (int t_begin, int t_end) const
+{
+    TimeChunk chunk;
+    //Indices of the first and last timestep to read
+    chunk.first_time_index = max(0, t_begin);
+    chunk.last_time_index = min(t_end-1, m_params.nt-1);
+    const auto n_t = static_cast<std::size_t>(chunk.last_time_index - chunk.first_time_index + 1);
+    if (m_params.file_in_lasy_format){
+        const auto data_size =
+            (m_params.file_in_cartesian_geom==0)?
+            (m_params.n_rz_azimuthal_components*n_t*m_params.nr) :
+            n_t*m_params.nx*m_params.ny;
+        chunk.h_E_lasy_data.resize(data_size);
+    } else{
+        chunk.h_E_binary_data.resize(n_t*m_params.nx*m_params.ny);
+    }
+    return chunk;
+}
+
 void
-WarpXLaserProfiles::FromFileLaserProfile::read_data_t_chunk (int t_begin, int t_end)
+WarpXLaserProfiles::FromFileLaserProfile::read_data_t_chunk (TimeChunk& chunk) const
 {
 #ifdef WARPX_USE_OPENPMD
     //Indices of the first and last timestep to read
-    auto const i_first = static_cast<long unsigned int>(max(0, t_begin));
-    auto const i_last = static_cast<long unsigned int>(min(t_end-1, m_params.nt-1));
-    amrex::Print() << Utils::TextMsg::Info(
-        "Reading [" + std::to_string(i_first) + ", " + std::to_string(i_last) +
-            "] data chunk from " + m_params.lasy_file_name);
-    const auto data_size =
-        (m_params.file_in_cartesian_geom==0)?
-        (m_params.n_rz_azimuthal_components*(i_last-i_first+1)*m_params.nr) :
-        (i_last-i_first+1)*m_params.nx*m_params.ny;
-    m_params.E_lasy_data.resize(data_size);
-    Vector<Complex> h_E_lasy_data(m_params.E_lasy_data.size());
-    if(ParallelDescriptor::IOProcessor()){
-        auto series = io::Series(m_params.lasy_file_name, io::Access::READ_ONLY);
-        auto i = series.iterations[0];
-        auto E = i.meshes["laserEnvelope"];
-        auto E_laser = E[io::RecordComponent::SCALAR];
-        openPMD:: Extent full_extent = E_laser.getExtent();
-        if (m_params.file_in_cartesian_geom==0) {
-            const openPMD::Extent read_extent = { full_extent[0], (i_last - i_first + 1), full_extent[2]};
-            auto r_data = E_laser.loadChunk< std::complex<double> >(io::Offset{ 0, i_first,  0}, read_extent);
-            const auto read_size = (i_last - i_first + 1)*m_params.nr;
-            series.flush();
-            for (int m=0; m<m_params.n_rz_azimuthal_components; m++){
-                for (auto j=0u; j<read_size; j++) {
-                    h_E_lasy_data[j+m*read_size] = Complex{
-                        static_cast<amrex::Real>(r_data.get()[j+m*read_size].real()),
-                        static_cast<amrex::Real>(r_data.get()[j+m*read_size].imag())};
-                }
-            }
-        } else{
-            const openPMD::Extent read_extent = {(i_last - i_first + 1), full_extent[1], full_extent[2]};
-            auto x_data = E_laser.loadChunk< std::complex<double> >(io::Offset{i_first, 0, 0}, read_extent);
-            const auto read_size = (i_last - i_first + 1)*m_params.nx*m_params.ny;
-            series.flush();
+    auto const i_first = static_cast<long unsigned int>(chunk.first_time_index);
+    auto const i_last = static_cast<long unsigned int>(chunk.last_time_index);
+    auto& h_E_lasy_data = chunk.h_E_lasy_data;
+    auto series = io::Series(m_params.lasy_file_name, io::Access::READ_ONLY);
+    auto i = series.iterations[0];
+    auto E = i.meshes["laserEnvelope"];
+    auto E_laser = E[io::RecordComponent::SCALAR];
+    openPMD:: Extent full_extent = E_laser.getExtent();
+    if (m_params.file_in_cartesian_geom==0) {
+        const openPMD::Extent read_extent = { full_extent[0], (i_last - i_first + 1), full_extent[2]};
+        auto r_data = E_laser.loadChunk< std::complex<double> >(io::Offset{ 0, i_first,  0}, read_extent);
+        const auto read_size = (i_last - i_first + 1)*m_params.nr;
+        series.flush();
+        for (int m=0; m<m_params.n_rz_azimuthal_components; m++){
             for (auto j=0u; j<read_size; j++) {
-                h_E_lasy_data[j] = Complex{
-                    static_cast<amrex::Real>(x_data.get()[j].real()),
-                    static_cast<amrex::Real>(x_data.get()[j].imag())};
+                h_E_lasy_data[j+m*read_size] = Complex{
+                    static_cast<amrex::Real>(r_data.get()[j+m*read_size].real()),
+                    static_cast<amrex::Real>(r_data.get()[j+m*read_size].imag())};
             }
         }
+    } else{
+        const openPMD::Extent read_extent = {(i_last - i_first + 1), full_extent[1], full_extent[2]};
+        auto x_data = E_laser.loadChunk< std::complex<double> >(io::Offset{i_first, 0, 0}, read_extent);
+        const auto read_size = (i_last - i_first + 1)*m_params.nx*m_params.ny;
+        series.flush();
+        for (auto j=0u; j<read_size; j++) {
+            h_E_lasy_data[j] = Complex{
+                static_cast<amrex::Real>(x_data.get()[j].real()),
+                static_cast<amrex::Real>(x_data.get()[j].imag())};
+        }
     }
-    //Broadcast E_lasy_data
-    ParallelDescriptor::Bcast(h_E_lasy_data.dataPtr(),
-        h_E_lasy_data.size(), ParallelDescriptor::IOProcessorNumber());
-    Gpu::copyAsync(Gpu::hostToDevice,h_E_lasy_data.begin(),h_E_lasy_data.end(),m_params.E_lasy_data.begin());
-    Gpu::synchronize();
-    //Update first and last indices
-    m_params.first_time_index = static_cast<int>(i_first);
-    m_params.last_time_index = static_cast<int>(i_last);
 #else
-    amrex::ignore_unused(t_begin, t_end);
+    amrex::ignore_unused(chunk);
 #endif
 }
 
 void
-WarpXLaserProfiles::FromFileLaserProfile::read_binary_data_t_chunk (int t_begin, int t_end)
+WarpXLaserProfiles::FromFileLaserProfile::read_binary_data_t_chunk (TimeChunk& chunk) const
 {
-    amrex::Print() << Utils::TextMsg::Info(
-        "Reading [" + std::to_string(t_begin) + ", " + std::to_string(t_end) +
-            "] data chunk from " + m_params.binary_file_name);
-
     //Indices of the first and last timestep to read
-    auto i_first = max(0, t_begin);
-    auto i_last = min(t_end-1, m_params.nt-1);
-    const int data_size = (i_last-i_first+1)*m_params.nx*m_params.ny;
-    m_params.E_binary_data.resize(data_size);
-    Vector<Real> h_E_binary_data(m_params.E_binary_data.size());
-    if(ParallelDescriptor::IOProcessor()){
-        //Read data chunk
-        std::ifstream inp(m_params.binary_file_name, std::ios::binary);
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to open binary file"); }
-        inp.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+    const auto i_first = chunk.first_time_index;
+    const auto i_last = chunk.last_time_index;
+    //Read data chunk
+    std::ifstream inp(m_params.binary_file_name, std::ios::binary);
+    if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to open binary file"); }
+    inp.exceptions(std::ios_base::failbit | std::ios_base::badbit);
 #if (defined(WARPX_DIM_3D))
-        auto skip_amount = 1 +
-        3*sizeof(uint32_t) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        sizeof(double)*t_begin*m_params.nx*m_params.ny;
+    auto skip_amount = 1 +
+    3*sizeof(uint32_t) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    sizeof(double)*i_first*m_params.nx*m_params.ny;
 #else
-        auto skip_amount = 1 +
-        3*sizeof(uint32_t) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        1*sizeof(double) +
-        sizeof(double)*t_begin*m_params.nx*m_params.ny;
+    auto skip_amount = 1 +
+    3*sizeof(uint32_t) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    1*sizeof(double) +
+    sizeof(double)*i_first*m_params.nx*m_params.ny;
 #endif
-        inp.seekg(static_cast<std::streamoff>(skip_amount));
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
-        const int read_size = (i_last - i_first + 1)*
-            m_params.nx*m_params.ny;
-        Vector<double> buf_e(read_size);
-        inp.read(reinterpret_cast<char*>(buf_e.dataPtr()), static_cast<std::streamsize>(read_size*sizeof(double)));
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
-        std::transform(buf_e.begin(), buf_e.end(), h_E_binary_data.begin(),
-            [](auto x) {return static_cast<amrex::Real>(x);} );
-    }
+    inp.seekg(static_cast<std::streamoff>(skip_amount));
+    if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
+    const int read_size = (i_last - i_first + 1)*
+        m_params.nx*m_params.ny;
+    Vector<double> buf_e(read_size);
+    inp.read(reinterpret_cast<char*>(buf_e.dataPtr()), static_cast<std::streamsize>(read_size*sizeof(double)));
+    if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
+    std::transform(buf_e.begin(), buf_e.end(), chunk.h_E_binary_data.begin(),
+        [](auto x) {return static_cast<amrex::Real>(x);} );
+}
 
-    //Broadcast E_binary_data
-    ParallelDescriptor::Bcast(h_E_binary_data.dataPtr(),
-        h_E_binary_data.size(), ParallelDescriptor::IOProcessorNumber());
+void
+WarpXLaserProfiles::FromFileLaserProfile::load_t_chunk (int t_begin, int t_end)
+{
+    TimeChunk chunk = make_t_chunk(t_begin, t_end);
+    amrex::Print() << Utils::TextMsg::Info(
+        "Reading [" + std::to_string(chunk.first_time_index) + ", " + std::to_string(chunk.last_time_index) +
+            "] data chunk from " +
+            (m_params.file_in_lasy_format ? m_params.lasy_file_name : m_params.binary_file_name));
 
-    Gpu::copyAsync(Gpu::hostToDevice,h_E_binary_data.begin(),h_E_binary_data.end(),m_params.E_binary_data.begin());
-    Gpu::synchronize();
+    if (m_params.file_in_lasy_format){
+#ifdef WARPX_USE_OPENPMD
+        if(ParallelDescriptor::IOProcessor()){ read_data_t_chunk(chunk); }
+        //Broadcast E_lasy_data
+        ParallelDescriptor::Bcast(chunk.h_E_lasy_data.dataPtr(),
+            chunk.h_E_lasy_data.size(), ParallelDescriptor::IOProcessorNumber());
+#endif
+    } else{
+        if(ParallelDescriptor::IOProcessor()){ read_binary_data_t_chunk(chunk); }
+        //Broadcast E_binary_data
+        ParallelDescriptor::Bcast(chunk.h_E_binary_data.dataPtr(),
+            chunk.h_E_binary_data.size(), ParallelDescriptor::IOProcessorNumber());
+    }
+    set_t_chunk(chunk);
+}
 
+void
+WarpXLaserProfiles::FromFileLaserProfile::set_t_chunk (TimeChunk const& chunk)
+{
+    if (m_params.file_in_lasy_format){
+        m_params.E_lasy_data.resize(chunk.h_E_lasy_data.size());
+        Gpu::copyAsync(Gpu::hostToDevice,
+            chunk.h_E_lasy_data.begin(), chunk.h_E_lasy_data.end(), m_params.E_lasy_data.begin());
+    } else{
+        m_params.E_binary_data.resize(chunk.h_E_binary_data.size());
+        Gpu::copyAsync(Gpu::hostToDevice,
+            chunk.h_E_binary_data.begin(), chunk.h_E_binary_data.end(), m_params.E_binary_data.begin());
+    }
+    Gpu::synchronize();
     //Update first and last indices
-    m_params.first_time_index = static_cast<int>(i_first);
-    m_params.last_time_index = static_cast<int>(i_last);
+    m_params.first_time_index = chunk.first_time_index;
+    m_params.last_time_index = chunk.last_time_index;
+}
+
+void
+WarpXLaserProfiles::FromFileLaserProfile::start_prefetch ()
+{
+    //Nothing left to read
+    if (m_params.last_time_index >= m_params.nt-1) { return; }
+
+    //The next chunk starts with the last timestep of the current one, since both the
+    //left and right timesteps are needed for the interpolation
+    m_next_chunk = make_t_chunk(m_params.last_time_index, m_params.last_time_index+m_params.time_chunk_size);
+    m_next_chunk_bcast_started = false;
+    amrex::Print() << Utils::TextMsg::Info(
+        "Prefetching [" + std::to_string(m_next_chunk.first_time_index) + ", " +
+            std::to_string(m_next_chunk.last_time_index) + "] data chunk from " +
+            (m_params.file_in_lasy_format ? m_params.lasy_file_name : m_params.binary_file_name));
+
+    if(ParallelDescriptor::IOProcessor()){
+        m_next_chunk_read = std::async(std::launch::async, [this] () {
+            if (m_params.file_in_lasy_format){
+                read_data_t_chunk(m_next_chunk);
+            } else{
+                read_binary_data_t_chunk(m_next_chunk);
+            }
+        });
+    }
+}
+
+void
+WarpXLaserProfiles::FromFileLaserProfile::start_prefetch_bcast ()
+{
+    //Wait for the end of the read (and rethrow its errors)
+    if (m_next_chunk_read.valid()) { m_next_chunk_read.get(); }
+    m_next_chunk_bcast_started = true;
+
+#ifdef AMREX_USE_MPI
+    if (ParallelDescriptor::NProcs() == 1) { return; }
+    // a Complex is broadcast as two Reals
+    static_assert(sizeof(Complex) == 2*sizeof(amrex::Real));
+    auto* const data = m_params.file_in_lasy_format ?
+        reinterpret_cast<amrex::Real*>(m_next_chunk.h_E_lasy_data.dataPtr()) :
+        m_next_chunk.h_E_binary_data.dataPtr();
+    const std::size_t count = m_params.file_in_lasy_format ?
+        2*m_next_chunk.h_E_lasy_data.size() : m_next_chunk.h_E_binary_data.size();
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        count <= static_cast<std::size_t>(std::numeric_limits<int>::max()),
+        "The time chunk of the laser file is too large to be prefetched: reduce time_chunk_size");
+    BL_MPI_REQUIRE( MPI_Ibcast(data, static_cast<int>(count),
+        ParallelDescriptor::Mpi_typemap<amrex::Real>::type(),
+        ParallelDescriptor::IOProcessorNumber(), ParallelDescriptor::Communicator(),
+        &m_next_chunk_request) );
+#endif
+}
+
+bool
+WarpXLaserProfiles::FromFileLaserProfile::finish_prefetch (int idx_t_left, int idx_t_right)
+{
+    if (m_next_chunk.first_time_index < 0) { return false; }
+
+    if (!m_next_chunk_bcast_started) { start_prefetch_bcast(); }
+#ifdef AMREX_USE_MPI
+    if (m_next_chunk_request != MPI_REQUEST_NULL) {
+        BL_MPI_REQUIRE( MPI_Wait(&m_next_chunk_request, MPI_STATUS_IGNORE) );
+    }
+#endif
+
+    //The time indices can skip the prefetched chunk if the timestep of the file is small
+    const bool use_next_chunk =
+        idx_t_left >= m_next_chunk.first_time_index && idx_t_right <= m_next_chunk.last_time_index;
+    if (use_next_chunk) { set_t_chunk(m_next_chunk); }
+    m_next_chunk = TimeChunk{};
+    return use_next_chunk;
 }
 
 void
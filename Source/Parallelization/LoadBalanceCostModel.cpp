@@ -0,0 +1,149 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "LoadBalanceCostModel.H"
+
+#include "Utils/Parser/ParserUtils.H"
+#include "Utils/TextMsg.H"
+
+#include <AMReX_ParmParse.H>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+using namespace amrex::literals;
+
+LoadBalanceCostModel::LoadBalanceCostModel ()
+{
+    const amrex::ParmParse pp_algo("algo");
+    utils::parser::queryWithParser(pp_algo, "costs_model_forgetting_factor", m_forgetting_factor);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_forgetting_factor >= 0._rt && m_forgetting_factor < 1._rt,
+        "algo.costs_model_forgetting_factor must be in [0, 1)");
+    pp_algo.query("costs_model_project_features", m_project_features);
+}
+
+void
+LoadBalanceCostModel::PredictCosts (int lev, std::vector<amrex::Real> const& features,
+                                    std::vector<amrex::Real>& costs, int step, int horizon,
+                                    int nsteps, amrex::Real decay)
+{
+    const std::size_t nboxes = costs.size();
+    if (nboxes == 0) { return; }
+    const std::size_t nfeatures = features.size() / nboxes;
+
+    if (static_cast<int>(m_levels.size()) <= lev) { m_levels.resize(lev+1); }
+    auto& model = m_levels[lev];
+
+    // the features changed (e.g., new species): restart the fit
+    if (model.coefficients.size() != nfeatures) {
+        model = LevelModel{};
+        model.normal_matrix.assign(nfeatures*nfeatures, 0.);
+        model.normal_rhs.assign(nfeatures, 0.);
+        model.coefficients.assign(nfeatures, 0.);
+    }
+    // the boxes changed (e.g., regrid): the rate of change of the features is unknown
+    const bool has_previous = (model.previous_features.size() == features.size())
+        && (model.previous_step >= 0) && (step > model.previous_step);
+
+    // The measured costs are the sum over the last nsteps steps of the cost of the step
+    // k steps ago weighted by decay^k: they are fitted with the features summed with the
+    // same weights, the features varying linearly since the previous load balancing
+    double weight_sum = 0.;
+    double weighted_lag = 0.;
+    double weight = 1.;
+    for (int k = 0; k < std::max(nsteps, 1); ++k) {
+        weight_sum += weight;
+        weighted_lag += weight*k;
+        weight *= std::max(0., static_cast<double>(decay));
+    }
+    std::vector<double> fit_features(features.size());
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        const double rate = has_previous ?
+            (features[i] - model.previous_features[i]) / (step - model.previous_step) : 0.;
+        fit_features[i] = std::max(0., weight_sum*features[i] - weighted_lag*rate);
+    }
+
+    double total_cost = 0.;
+    for (auto const cost : costs) { total_cost += cost; }
+    if (total_cost > 0.) {
+        // Accumulate the normal equations of the least-squares fit, forgetting the older fits
+        for (auto& v : model.normal_matrix) { v *= m_forgetting_factor; }
+        for (auto& v : model.normal_rhs) { v *= m_forgetting_factor; }
+        for (std::size_t ib = 0; ib < nboxes; ++ib) {
+            double const* const f = fit_features.data() + ib*nfeatures;
+            for (std::size_t j = 0; j < nfeatures; ++j) {
+                if (f[j] == 0.) { continue; }
+                for (std::size_t k = 0; k < nfeatures; ++k) {
+                    model.normal_matrix[j*nfeatures+k] += f[j]*f[k];
+                }
+                model.normal_rhs[j] += f[j]*costs[ib];
+            }
+        }
+        SolveNonNegative(model.normal_matrix, model.normal_rhs, model.coefficients);
+    }
+
+    // Predict the costs with the features projected over the horizon
+    std::vector<amrex::Real> predicted_costs(nboxes, 0._rt);
+    double total_predicted_cost = 0.;
+    for (std::size_t ib = 0; ib < nboxes; ++ib) {
+        double cost = 0.;
+        for (std::size_t j = 0; j < nfeatures; ++j) {
+            const std::size_t i = ib*nfeatures + j;
+            double f = features[i];
+            if (m_project_features && has_previous) {
+                const double rate = (f - model.previous_features[i]) / (step - model.previous_step);
+                f = std::max(0., f + rate*horizon);
+            }
+            cost += model.coefficients[j]*f;
+        }
+        predicted_costs[ib] = static_cast<amrex::Real>(cost);
+        total_predicted_cost += cost;
+    }
+
+    model.previous_features = features;
+    model.previous_step = step;
+
+    // keep the measured costs until the model predicts something
+    if (total_predicted_cost > 0.) { costs = std::move(predicted_costs); }
+}
+
+void
+LoadBalanceCostModel::SolveNonNegative (std::vector<double> const& matrix,
+                                        std::vector<double> const& rhs,
+                                        std::vector<double>& coefficients)
+{
+    // Projected Gauss-Seidel: exact minimization of the least-squares error along each
+    // coefficient in turn, with the constraint coefficient >= 0. The features can be
+    // collinear (e.g., the number of cells if all boxes have the same size), which only
+    // makes the solution non-unique.
+    const std::size_t n = rhs.size();
+    constexpr int max_sweeps = 500;
+    constexpr double tolerance = 1.e-10;
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        double max_change = 0.;
+        double max_coefficient = 0.;
+        for (std::size_t j = 0; j < n; ++j) {
+            const double diag = matrix[j*n+j];
+            if (diag <= 0.) {
+                // feature that is zero in all the boxes
+                coefficients[j] = 0.;
+                continue;
+            }
+            double residual = rhs[j];
+            for (std::size_t k = 0; k < n; ++k) {
+                residual -= matrix[j*n+k]*coefficients[k];
+            }
+            const double updated = std::max(0., coefficients[j] + residual/diag);
+            max_change = std::max(max_change, std::abs(updated - coefficients[j])*std::sqrt(diag));
+            max_coefficient = std::max(max_coefficient, updated*std::sqrt(diag));
+            coefficients[j] = updated;
+        }
+        if (max_change <= tolerance*max_coefficient) { break; }
+    }
+}
@@ -603,37 +603,75 @@ void WarpX::UpdateCurrentNodalToStag (amrex::MultiFab& dst, amrex::MultiFab cons
 void
 WarpX::FillBoundaryB (IntVect ng, std::optional<bool> nodal_sync)
 {
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
     for (int lev = 0; lev <= finest_level; ++lev)
     {
-        FillBoundaryB(lev, ng, nodal_sync);
+        PrepareFillBoundaryB(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        if (lev > 0) { PrepareFillBoundaryB(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryE (IntVect ng, std::optional<bool> nodal_sync)
 {
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
     for (int lev = 0; lev <= finest_level; ++lev)
     {
-        FillBoundaryE(lev, ng, nodal_sync);
+        PrepareFillBoundaryE(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        if (lev > 0) { PrepareFillBoundaryE(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
+}
+
+void
+WarpX::FillBoundaryEB (IntVect ng, std::optional<bool> nodal_sync)
+{
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        PrepareFillBoundaryE(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        PrepareFillBoundaryB(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        if (lev > 0) {
+            PrepareFillBoundaryE(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period);
+            PrepareFillBoundaryB(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period);
+        }
+    }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryF (IntVect ng, std::optional<bool> nodal_sync)
 {
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
     for (int lev = 0; lev <= finest_level; ++lev)
     {
-        FillBoundaryF(lev, ng, nodal_sync);
+        PrepareFillBoundaryF(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        if (lev > 0) { PrepareFillBoundaryF(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryG (IntVect ng, std::optional<bool> nodal_sync)
 {
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
     for (int lev = 0; lev <= finest_level; ++lev)
     {
-        FillBoundaryG(lev, ng, nodal_sync);
+        PrepareFillBoundaryG(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+        if (lev > 0) { PrepareFillBoundaryG(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
@@ -658,12 +696,30 @@ WarpX::FillBoundaryE_avg (IntVect ng)
 void
 WarpX::FillBoundaryE (int lev, IntVect ng, std::optional<bool> nodal_sync)
 {
-    FillBoundaryE(lev, PatchType::fine, ng, nodal_sync);
-    if (lev > 0) { FillBoundaryE(lev, PatchType::coarse, ng, nodal_sync); }
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryE(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+    if (lev > 0) { PrepareFillBoundaryE(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryE (const int lev, const PatchType patch_type, const amrex::IntVect ng, std::optional<bool> nodal_sync)
+{
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryE(lev, patch_type, ng, nodal_sync, mf, mf_ng, mf_period);
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
+}
+
+void
+WarpX::PrepareFillBoundaryE (const int lev, const PatchType patch_type, const amrex::IntVect ng,
+                             std::optional<bool> nodal_sync,
+                             amrex::Vector<amrex::MultiFab*>& mf_fill,
+                             amrex::Vector<amrex::IntVect>& mf_fill_ng,
+                             amrex::Vector<amrex::Periodicity>& mf_fill_period)
 {
     std::array<amrex::MultiFab*,3> mf;
     amrex::Periodicity period;
@@ -700,27 +756,46 @@ WarpX::FillBoundaryE (const int lev, const PatchType patch_type, const amrex::In
 #endif
     }
 
-    // Fill guard cells in valid domain
+    // Guard cells to fill in valid domain
     for (int i = 0; i < 3; ++i)
     {
         WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
             ng.allLE(mf[i]->nGrowVect()),
             "Error: in FillBoundaryE, requested more guard cells than allocated");
 
-        const amrex::IntVect nghost = (safe_guard_cells) ? mf[i]->nGrowVect() : ng;
-        ablastr::utils::communication::FillBoundary(*mf[i], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+        mf_fill.push_back(mf[i]);
+        mf_fill_ng.push_back((safe_guard_cells) ? mf[i]->nGrowVect() : ng);
+        mf_fill_period.push_back(period);
     }
 }
 
 void
 WarpX::FillBoundaryB (int lev, IntVect ng, std::optional<bool> nodal_sync)
 {
-    FillBoundaryB(lev, PatchType::fine, ng, nodal_sync);
-    if (lev > 0) { FillBoundaryB(lev, PatchType::coarse, ng, nodal_sync); }
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryB(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+    if (lev > 0) { PrepareFillBoundaryB(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryB (const int lev, const PatchType patch_type, const amrex::IntVect ng, std::optional<bool> nodal_sync)
+{
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryB(lev, patch_type, ng, nodal_sync, mf, mf_ng, mf_period);
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
+}
+
+void
+WarpX::PrepareFillBoundaryB (const int lev, const PatchType patch_type, const amrex::IntVect ng,
+                             std::optional<bool> nodal_sync,
+                             amrex::Vector<amrex::MultiFab*>& mf_fill,
+                             amrex::Vector<amrex::IntVect>& mf_fill_ng,
+                             amrex::Vector<amrex::Periodicity>& mf_fill_period)
 {
     std::array<amrex::MultiFab*,3> mf;
     amrex::Periodicity period;
@@ -757,15 +832,16 @@ WarpX::FillBoundaryB (const int lev, const PatchType patch_type, const amrex::In
 #endif
     }
 
-    // Fill guard cells in valid domain
+    // Guard cells to fill in valid domain
     for (int i = 0; i < 3; ++i)
     {
         WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
             ng.allLE(mf[i]->nGrowVect()),
             "Error: in FillBoundaryB, requested more guard cells than allocated");
 
-        const amrex::IntVect nghost = (safe_guard_cells) ? mf[i]->nGrowVect() : ng;
-        ablastr::utils::communication::FillBoundary(*mf[i], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+        mf_fill.push_back(mf[i]);
+        mf_fill_ng.push_back((safe_guard_cells) ? mf[i]->nGrowVect() : ng);
+        mf_fill_period.push_back(period);
     }
 }
 
@@ -877,12 +953,29 @@ WarpX::FillBoundaryB_avg (int lev, PatchType patch_type, IntVect ng)
 void
 WarpX::FillBoundaryF (int lev, IntVect ng, std::optional<bool> nodal_sync)
 {
-    FillBoundaryF(lev, PatchType::fine, ng, nodal_sync);
-    if (lev > 0) { FillBoundaryF(lev, PatchType::coarse, ng, nodal_sync); }
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryF(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
+    if (lev > 0) { PrepareFillBoundaryF(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period); }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void
 WarpX::FillBoundaryF (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync)
+{
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryF(lev, patch_type, ng, nodal_sync, mf, mf_ng, mf_period);
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
+}
+
+void
+WarpX::PrepareFillBoundaryF (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync,
+                             amrex::Vector<amrex::MultiFab*>& mf_fill,
+                             amrex::Vector<amrex::IntVect>& mf_fill_ng,
+                             amrex::Vector<amrex::Periodicity>& mf_fill_period)
 {
     if (patch_type == PatchType::fine)
     {
@@ -894,9 +987,9 @@ WarpX::FillBoundaryF (int lev, PatchType patch_type, IntVect ng, std::optional<b
 
         if (F_fp[lev])
         {
-            const amrex::Periodicity& period = Geom(lev).periodicity();
-            const amrex::IntVect& nghost = (safe_guard_cells) ? F_fp[lev]->nGrowVect() : ng;
-            ablastr::utils::communication::FillBoundary(*F_fp[lev], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+            mf_fill.push_back(F_fp[lev].get());
+            mf_fill_ng.push_back((safe_guard_cells) ? F_fp[lev]->nGrowVect() : ng);
+            mf_fill_period.push_back(Geom(lev).periodicity());
         }
     }
     else if (patch_type == PatchType::coarse)
@@ -909,24 +1002,40 @@ WarpX::FillBoundaryF (int lev, PatchType patch_type, IntVect ng, std::optional<b
 
         if (F_cp[lev])
         {
-            const amrex::Periodicity& period = Geom(lev-1).periodicity();
-            const amrex::IntVect& nghost = (safe_guard_cells) ? F_cp[lev]->nGrowVect() : ng;
-            ablastr::utils::communication::FillBoundary(*F_cp[lev], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+            mf_fill.push_back(F_cp[lev].get());
+            mf_fill_ng.push_back((safe_guard_cells) ? F_cp[lev]->nGrowVect() : ng);
+            mf_fill_period.push_back(Geom(lev-1).periodicity());
         }
     }
 }
 
 void WarpX::FillBoundaryG (int lev, IntVect ng, std::optional<bool> nodal_sync)
 {
-    FillBoundaryG(lev, PatchType::fine, ng, nodal_sync);
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryG(lev, PatchType::fine, ng, nodal_sync, mf, mf_ng, mf_period);
 
     if (lev > 0)
     {
-        FillBoundaryG(lev, PatchType::coarse, ng, nodal_sync);
+        PrepareFillBoundaryG(lev, PatchType::coarse, ng, nodal_sync, mf, mf_ng, mf_period);
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
 }
 
 void WarpX::FillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync)
+{
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
+    PrepareFillBoundaryG(lev, patch_type, ng, nodal_sync, mf, mf_ng, mf_period);
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms, nodal_sync);
+}
+
+void WarpX::PrepareFillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync,
+                                  amrex::Vector<amrex::MultiFab*>& mf_fill,
+                                  amrex::Vector<amrex::IntVect>& mf_fill_ng,
+                                  amrex::Vector<amrex::Periodicity>& mf_fill_period)
 {
     if (patch_type == PatchType::fine)
     {
@@ -938,9 +1047,9 @@ void WarpX::FillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optio
 
         if (G_fp[lev])
         {
-            const amrex::Periodicity& period = Geom(lev).periodicity();
-            const amrex::IntVect& nghost = (safe_guard_cells) ? G_fp[lev]->nGrowVect() : ng;
-            ablastr::utils::communication::FillBoundary(*G_fp[lev], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+            mf_fill.push_back(G_fp[lev].get());
+            mf_fill_ng.push_back((safe_guard_cells) ? G_fp[lev]->nGrowVect() : ng);
+            mf_fill_period.push_back(Geom(lev).periodicity());
         }
     }
     else if (patch_type == PatchType::coarse)
@@ -953,9 +1062,9 @@ void WarpX::FillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optio
 
         if (G_cp[lev])
         {
-            const amrex::Periodicity& period = Geom(lev-1).periodicity();
-            const amrex::IntVect& nghost = (safe_guard_cells) ? G_cp[lev]->nGrowVect() : ng;
-            ablastr::utils::communication::FillBoundary(*G_cp[lev], nghost, WarpX::do_single_precision_comms, period, nodal_sync);
+            mf_fill.push_back(G_cp[lev].get());
+            mf_fill_ng.push_back((safe_guard_cells) ? G_cp[lev]->nGrowVect() : ng);
+            mf_fill_period.push_back(Geom(lev-1).periodicity());
         }
     }
 }
@@ -963,22 +1072,29 @@ void WarpX::FillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optio
 void
 WarpX::FillBoundaryAux (IntVect ng)
 {
+    amrex::Vector<amrex::MultiFab*> mf;
+    amrex::Vector<amrex::IntVect> mf_ng;
+    amrex::Vector<amrex::Periodicity> mf_period;
     for (int lev = 0; lev <= finest_level-1; ++lev)
     {
-        FillBoundaryAux(lev, ng);
+        for (int i = 0; i < 3; ++i) {
+            mf.push_back(Efield_aux[lev][i].get());
+            mf.push_back(Bfield_aux[lev][i].get());
+        }
+        mf_ng.resize(mf.size(), ng);
+        mf_period.resize(mf.size(), Geom(lev).periodicity());
     }
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms);
 }
 
 void
 WarpX::FillBoundaryAux (int lev, IntVect ng)
 {
-    const amrex::Periodicity& period = Geom(lev).periodicity();
-    ablastr::utils::communication::FillBoundary(*Efield_aux[lev][0], ng, WarpX::do_single_precision_comms, period);
-    ablastr::utils::communication::FillBoundary(*Efield_aux[lev][1], ng, WarpX::do_single_precision_comms, period);
-    ablastr::utils::communication::FillBoundary(*Efield_aux[lev][2], ng, WarpX::do_single_precision_comms, period);
-    ablastr::utils::communication::FillBoundary(*Bfield_aux[lev][0], ng, WarpX::do_single_precision_comms, period);
-    ablastr::utils::communication::FillBoundary(*Bfield_aux[lev][1], ng, WarpX::do_single_precision_comms, period);
-    ablastr::utils::communication::FillBoundary(*Bfield_aux[lev][2], ng, WarpX::do_single_precision_comms, period);
+    const amrex::Vector<amrex::MultiFab*> mf{Efield_aux[lev][0].get(), Efield_aux[lev][1].get(), Efield_aux[lev][2].get(),
+                                             Bfield_aux[lev][0].get(), Bfield_aux[lev][1].get(), Bfield_aux[lev][2].get()};
+    const amrex::Vector<amrex::IntVect> mf_ng(mf.size(), ng);
+    const amrex::Vector<amrex::Periodicity> mf_period(mf.size(), Geom(lev).periodicity());
+    ablastr::utils::communication::FillBoundaryAggregated(mf, mf_ng, mf_period, WarpX::do_single_precision_comms);
 }
 
 void
@@ -1324,6 +1440,66 @@ void WarpX::SumBoundaryJ (
     }
 }
 
+bool WarpX::OverlapCurrentSum (const bool skip_current) const
+{
+    // The compatibility with the other algorithms is checked in ReadParameters
+    return do_overlap_current_sum && !skip_current && finest_level == 0 && !do_fluid_species;
+}
+
+amrex::IntVect WarpX::getInteriorTileMarginJ (const int lev) const
+{
+    amrex::IntVect ng_J(0);
+    for (int idim = 0; idim < 3; ++idim)
+    {
+        ng_J.max(current_fp[lev][idim]->nGrowVect());
+    }
+    amrex::IntVect margin = get_ng_depos_J() + ng_J;
+    if (use_filter)
+    {
+        margin += bilinear_filter.stencil_length_each_dir - amrex::IntVect(1);
+    }
+    return margin;
+}
+
+void WarpX::SumBoundaryJ_nowait (const int lev)
+{
+    WARPX_PROFILE("WarpX::SumBoundaryJ_nowait()");
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_current_sum_in_flight,
+        "The summation of the guard cells of the current has already been started");
+
+    // Without current centering and mesh refinement, only the guard cells used for
+    // the deposition contain data (see SumBoundaryJ): the filter is applied after
+    // the summation, in SumBoundaryJ_finish
+    for (int idim = 0; idim < 3; ++idim)
+    {
+        amrex::MultiFab& J = *current_fp[lev][idim];
+        amrex::IntVect src_ngrow = get_ng_depos_J();
+        src_ngrow.min(J.nGrowVect());
+        ablastr::utils::communication::SumBoundary_nowait(
+            J, 0, J.nComp(), src_ngrow, J.nGrowVect(), Geom(lev).periodicity());
+    }
+    m_current_sum_in_flight = true;
+}
+
+void WarpX::SumBoundaryJ_finish (const int lev)
+{
+    WARPX_PROFILE("WarpX::SumBoundaryJ_finish()");
+
+    for (int idim = 0; idim < 3; ++idim)
+    {
+        ablastr::utils::communication::SumBoundary_finish(*current_fp[lev][idim]);
+
+        // Since the filter is linear, filtering the summed current gives the same
+        // current in the valid cells as summing the filtered currents (as in SyncCurrent)
+        if (use_filter)
+        {
+            ApplyFilterJ(current_fp, lev, idim);
+        }
+    }
+    m_current_sum_in_flight = false;
+}
+
 /* /brief Update the currents of `lev` by adding the currents from particles
 *         that are in the mesh refinement patches at `lev+1`
 *
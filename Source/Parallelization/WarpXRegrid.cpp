@@ -12,6 +12,7 @@
 #include "Diagnostics/ReducedDiags/MultiReducedDiags.H"
 #include "EmbeddedBoundary/Enabled.H"
 #include "EmbeddedBoundary/WarpXFaceInfoBox.H"
+#include "FieldSolver/ElectrostaticSolvers/ElectrostaticSolver.H"
 #include "FieldSolver/FiniteDifferenceSolver/HybridPICModel/HybridPICModel.H"
 #include "Initialization/ExternalField.H"
 #include "Particles/MultiParticleContainer.H"
@@ -20,6 +21,7 @@
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXProfilerWrapper.H"
+#include "Utils/WarpXUtil.H"
 
 #include <AMReX.H>
 #include <AMReX_BLassert.H>
@@ -37,7 +39,9 @@
 #include <AMReX_ParIter.H>
 #include <AMReX_ParallelContext.H>
 #include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
 #include <AMReX_REAL.H>
+#include <AMReX_Reduce.H>
 #include <AMReX_Vector.H>
 #include <AMReX_iMultiFab.H>
 
@@ -45,12 +49,28 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
 
 using namespace amrex;
 
+namespace
+{
+    /** Costs of all the boxes, on all the processes */
+    std::vector<amrex::Real> GatherCosts (const LayoutData<amrex::Real>& lev_costs)
+    {
+        std::vector<amrex::Real> all_costs(lev_costs.size(), 0._rt);
+        for (const auto& i : lev_costs.IndexArray()) {
+            all_costs[i] = lev_costs[i];
+        }
+        ParallelAllReduce::Sum(all_costs.data(), static_cast<int>(all_costs.size()),
+                               ParallelContext::CommunicatorSub());
+        return all_costs;
+    }
+}
+
 void
 WarpX::CheckLoadBalance (int step)
 {
@@ -82,6 +102,11 @@ WarpX::LoadBalance ()
         // compute the costs on a per-rank basis
         ComputeCostsHeuristic(costs);
     }
+    else if (load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Model)
+    {
+        // replace the measured costs by the costs predicted until the next load balancing
+        PredictCostsWithModel();
+    }
 
     // By default, do not do a redistribute; this toggles to true if RemakeLevel
     // is called for any level
@@ -102,16 +127,33 @@ WarpX::LoadBalance ()
         amrex::Real currentEfficiency = 0.0;
         amrex::Real proposedEfficiency = 0.0;
 
-        newdm = (load_balance_with_sfc)
-            ? DistributionMapping::makeSFC(*costs[lev],
-                                           currentEfficiency, proposedEfficiency,
-                                           false,
-                                           ParallelDescriptor::IOProcessorNumber())
-            : DistributionMapping::makeKnapSack(*costs[lev],
-                                                currentEfficiency, proposedEfficiency,
-                                                nmax,
-                                                false,
-                                                ParallelDescriptor::IOProcessorNumber());
+        if (load_balance_max_moved_boxes > 0 || load_balance_max_moved_bytes > 0)
+        {
+            // Move a bounded number of boxes, to limit the data sent by RemakeLevel
+            const std::vector<amrex::Real> lev_costs = GatherCosts(*costs[lev]);
+            const std::vector<amrex::Long> lev_bytes = ComputeBoxMigrationBytes(lev);
+            if (ParallelDescriptor::MyProc() == ParallelDescriptor::IOProcessorNumber())
+            {
+                newdm = DistributionMapping(WarpXUtilLoadBalance::MakeIncrementalProcessorMap(
+                    DistributionMap(lev).ProcessorMap(), lev_costs, lev_bytes,
+                    ParallelContext::NProcsSub(),
+                    load_balance_max_moved_boxes, load_balance_max_moved_bytes,
+                    currentEfficiency, proposedEfficiency));
+            }
+        }
+        else
+        {
+            newdm = (load_balance_with_sfc)
+                ? DistributionMapping::makeSFC(*costs[lev],
+                                               currentEfficiency, proposedEfficiency,
+                                               false,
+                                               ParallelDescriptor::IOProcessorNumber())
+                : DistributionMapping::makeKnapSack(*costs[lev],
+                                                    currentEfficiency, proposedEfficiency,
+                                                    nmax,
+                                                    false,
+                                                    ParallelDescriptor::IOProcessorNumber());
+        }
         // As specified in the above calls to makeSFC and makeKnapSack, the new
         // distribution mapping is NOT communicated to all ranks; the loadbalanced
         // dm is up-to-date only on root, and we can decide whether to broadcast
@@ -390,6 +432,9 @@ WarpX::RemakeLevel (int lev, Real /*time*/, const BoxArray& ba, const Distributi
 
         SetDistributionMap(lev, dm);
 
+        // The MLMG operators of the electrostatic solver are defined on the old distribution mapping
+        m_electrostatic_solver->ResetSolverCache();
+
     } else
     {
         WARPX_ABORT_WITH_MESSAGE("RemakeLevel: to be implemented");
@@ -432,6 +477,192 @@ WarpX::ComputeCostsHeuristic (amrex::Vector<std::unique_ptr<amrex::LayoutData<am
     }
 }
 
+std::vector<amrex::Real>
+WarpX::ComputeCostModelFeatures (int lev)
+{
+    const auto & mypc_ref = GetInstance().GetPartContainer();
+    const int nSpecies = mypc_ref.nSpecies();
+    const auto collision_species = mypc_ref.GetCollisionSpeciesIDs();
+    const int ncollisions = static_cast<int>(collision_species.size());
+
+    // Features of a box: constant, cells, particles of each species, PML cells, EB cut cells,
+    // and pairs of particles of each collision
+    const int nfeatures = 4 + nSpecies + ncollisions;
+    const int ifeature_pml = 2 + nSpecies;
+    const int ifeature_eb = 3 + nSpecies;
+    const int ifeature_collisions = 4 + nSpecies;
+
+    const BoxArray& ba = costs[lev]->boxArray();
+    const auto nboxes = static_cast<std::size_t>(ba.size());
+    std::vector<amrex::Real> features(nboxes*nfeatures, 0._rt);
+    auto feature = [&] (int ibox, int ifeature) -> amrex::Real& {
+        return features[static_cast<std::size_t>(ibox)*nfeatures + ifeature];
+    };
+
+    for (int i_s = 0; i_s < nSpecies; ++i_s)
+    {
+        auto & myspc = mypc_ref.GetParticleContainer(i_s);
+        for (WarpXParIter pti(myspc, lev); pti.isValid(); ++pti)
+        {
+            feature(pti.index(), 2 + i_s) += static_cast<amrex::Real>(pti.numParticles());
+        }
+    }
+
+    const Box& domain = Geom(lev).Domain();
+    for (const auto& i : costs[lev]->IndexArray())
+    {
+        const Box& bx = ba[i];
+        const auto ncells = static_cast<amrex::Real>(bx.numPts());
+        feature(i, 0) = 1._rt;
+        feature(i, 1) = ncells;
+
+        if (do_pml)
+        {
+            // cells of the PML next to the box, on the sides of the domain with a PML
+            Box pml_bx = bx;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                if (WarpX::field_boundary_lo[idim] == FieldBoundaryType::PML) {
+                    pml_bx.growLo(idim, pml_ncell);
+                }
+                if (WarpX::field_boundary_hi[idim] == FieldBoundaryType::PML) {
+                    pml_bx.growHi(idim, pml_ncell);
+                }
+            }
+            feature(i, ifeature_pml) = static_cast<amrex::Real>(pml_bx.numPts() - (pml_bx & domain).numPts());
+        }
+
+        for (int ic = 0; ic < ncollisions; ++ic)
+        {
+            const auto& ids = collision_species[ic];
+            if (ids.empty()) { continue; }
+            const amrex::Real n_a = feature(i, 2 + ids[0]);
+            const amrex::Real n_b = (ids.size() > 1) ? feature(i, 2 + ids[1]) : n_a;
+            // the binary collisions pair each particle of the more numerous species
+            // with one particle of the other species, within each cell
+            feature(i, ifeature_collisions + ic) = std::max(n_a, n_b);
+        }
+    }
+
+#ifdef AMREX_USE_EB
+    if (EB::enabled())
+    {
+        auto const& flags = fieldEBFactory(lev).getMultiEBCellFlagFab();
+        for (MFIter mfi(flags); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            if (flags[mfi].getType(bx) != FabType::singlevalued) { continue; }
+            auto const& flag = flags.const_array(mfi);
+
+            ReduceOps<ReduceOpSum> reduce_op;
+            ReduceData<amrex::Long> reduce_data(reduce_op);
+            using ReduceTuple = typename decltype(reduce_data)::Type;
+            reduce_op.eval(bx, reduce_data,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+                {
+                    return {flag(i,j,k).isSingleValued() ? 1 : 0};
+                });
+            feature(mfi.index(), ifeature_eb) = static_cast<amrex::Real>(amrex::get<0>(reduce_data.value(reduce_op)));
+        }
+    }
+#else
+    amrex::ignore_unused(ifeature_eb);
+#endif
+
+    // each process computed the features of its boxes
+    ParallelAllReduce::Sum(features.data(), static_cast<int>(features.size()),
+                           ParallelContext::CommunicatorSub());
+    return features;
+}
+
+void
+WarpX::PredictCostsWithModel ()
+{
+    WARPX_PROFILE("WarpX::PredictCostsWithModel()");
+
+    if (!m_load_balance_cost_model) {
+        m_load_balance_cost_model = std::make_unique<LoadBalanceCostModel>();
+    }
+
+    const int step = istep[0];
+    // the costs are predicted for the middle of the period until the next load balancing
+    const int horizon = std::max(1, load_balance_intervals.localPeriod(step+1)/2);
+    // the costs were measured since the previous load balancing, and rescaled at each
+    // step by RescaleCosts with the period in which the step is
+    const int nsteps = std::max(1, step+1 - load_balance_intervals.previousContains(step+1));
+    const amrex::Real decay = 1._rt - 2._rt/nsteps;
+
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        const std::vector<amrex::Real> features = ComputeCostModelFeatures(lev);
+
+        std::vector<amrex::Real> lev_costs = GatherCosts(*costs[lev]);
+        const auto iarr = costs[lev]->IndexArray();
+
+        m_load_balance_cost_model->PredictCosts(lev, features, lev_costs, step, horizon,
+                                                nsteps, decay);
+
+        for (const auto& i : iarr) {
+            (*costs[lev])[i] = lev_costs[i];
+        }
+    }
+}
+
+std::vector<amrex::Long>
+WarpX::ComputeBoxMigrationBytes (int lev)
+{
+    // Size of the data of a cell, in the main fields that are remade with the level
+    amrex::Long cell_bytes = 0;
+    auto add_field = [&cell_bytes] (const std::unique_ptr<MultiFab>& mf) {
+        if (mf) { cell_bytes += mf->nComp()*static_cast<amrex::Long>(sizeof(amrex::Real)); }
+    };
+    for (int idim = 0; idim < 3; ++idim)
+    {
+        add_field(Efield_fp[lev][idim]);
+        add_field(Bfield_fp[lev][idim]);
+        add_field(current_fp[lev][idim]);
+        if (lev > 0)
+        {
+            add_field(Efield_aux[lev][idim]);
+            add_field(Bfield_aux[lev][idim]);
+            add_field(Efield_cp[lev][idim]);
+            add_field(Bfield_cp[lev][idim]);
+            add_field(current_cp[lev][idim]);
+        }
+    }
+    add_field(rho_fp[lev]);
+    add_field(F_fp[lev]);
+    add_field(G_fp[lev]);
+    if (lev > 0) { add_field(rho_cp[lev]); }
+
+    const BoxArray& ba = costs[lev]->boxArray();
+    std::vector<amrex::Long> bytes(ba.size(), 0);
+    for (const auto& i : costs[lev]->IndexArray())
+    {
+        bytes[i] += ba[i].numPts()*cell_bytes;
+    }
+
+    const auto & mypc_ref = GetInstance().GetPartContainer();
+    for (int i_s = 0; i_s < mypc_ref.nSpecies(); ++i_s)
+    {
+        auto & myspc = mypc_ref.GetParticleContainer(i_s);
+        // pure SoA particles: id and cpu, and the real and int components
+        const auto particle_bytes = static_cast<amrex::Long>(
+            sizeof(uint64_t)
+            + myspc.NumRealComps()*sizeof(amrex::ParticleReal)
+            + myspc.NumIntComps()*sizeof(int));
+        for (WarpXParIter pti(myspc, lev); pti.isValid(); ++pti)
+        {
+            bytes[pti.index()] += pti.numParticles()*particle_bytes;
+        }
+    }
+
+    // each process computed the size of its boxes
+    ParallelAllReduce::Sum(bytes.data(), static_cast<int>(bytes.size()),
+                           ParallelContext::CommunicatorSub());
+    return bytes;
+}
+
 void
 WarpX::ResetCosts ()
 {
@@ -452,8 +683,8 @@ WarpX::ResetCosts ()
 void
 WarpX::RescaleCosts (int step)
 {
-    // rescale is only used for timers
-    if (WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Timers)
+    // rescale is only used for timers (measured costs, also used by the cost model)
+    if (WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Heuristic)
     {
         return;
     }
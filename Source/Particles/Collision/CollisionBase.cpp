@@ -11,6 +11,7 @@
 #include <AMReX_ParmParse.H>
 
 CollisionBase::CollisionBase (const std::string& collision_name)
+    : m_collision_name{collision_name}
 {
 
     // read collision species
@@ -73,6 +73,13 @@ CollisionHandler::CollisionHandler(MultiParticleContainer const * const mypc)
 
     }
 
+    m_scratch_arena = std::make_unique<CollisionScratchArena>();
+    m_binning_cache = std::make_unique<ParticleBinningCache>();
+    for (auto& collision : allcollisions) {
+        collision->set_scratch_arena(m_scratch_arena.get());
+        collision->set_binning_cache(m_binning_cache.get());
+    }
+
 }
 
 /** Perform all collisions
@@ -85,11 +92,31 @@ CollisionHandler::CollisionHandler(MultiParticleContainer const * const mypc)
 void CollisionHandler::doCollisions ( amrex::Real cur_time, amrex::Real dt, MultiParticleContainer* mypc)
 {
 
+    // The particles have moved since the previous call
+    m_binning_cache->invalidate();
+
     for (auto& collision : allcollisions) {
         int const ndt = collision->get_ndt();
         if ( int(std::floor(cur_time/dt)) % ndt == 0 ) {
             collision->doCollisions(cur_time, dt*ndt, mypc);
+            if (collision->changesNumberOfParticles()) { m_binning_cache->invalidate(); }
         }
     }
 
 }
+
+void CollisionHandler::PrintScratchStatistics () const
+{
+    if (allcollisions.empty()) { return; }
+    m_scratch_arena->PrintStatistics();
+}
+
+amrex::Vector<amrex::Vector<std::string>>
+CollisionHandler::GetCollisionSpeciesNames () const
+{
+    amrex::Vector<amrex::Vector<std::string>> species_names;
+    for (auto const& collision : allcollisions) {
+        species_names.push_back(collision->get_species_names());
+    }
+    return species_names;
+}
@@ -0,0 +1,45 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "CollisionScratchArena.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+CollisionScratchArena::Statistics
+CollisionScratchArena::getStatistics () const
+{
+    Statistics stats;
+    for (auto const& scratch : m_threads) {
+        stats.bytes_reserved += scratch.bytes_reserved;
+        stats.max_buffers_in_use = std::max(stats.max_buffers_in_use, scratch.max_in_use);
+        stats.n_borrows += scratch.n_borrows;
+        stats.n_grows += scratch.n_grows;
+    }
+    return stats;
+}
+
+void
+CollisionScratchArena::PrintStatistics () const
+{
+    const Statistics stats = getStatistics();
+
+    auto max_bytes = static_cast<amrex::Long>(stats.bytes_reserved);
+    auto total_bytes = static_cast<amrex::Long>(stats.bytes_reserved);
+    auto max_buffers = static_cast<amrex::Long>(stats.max_buffers_in_use);
+    amrex::Long n_borrows = stats.n_borrows;
+    amrex::Long n_grows = stats.n_grows;
+    amrex::ParallelDescriptor::ReduceLongMax(max_bytes);
+    amrex::ParallelDescriptor::ReduceLongMax(max_buffers);
+    amrex::ParallelDescriptor::ReduceLongSum(total_bytes);
+    amrex::ParallelDescriptor::ReduceLongSum(n_borrows);
+    amrex::ParallelDescriptor::ReduceLongSum(n_grows);
+
+    amrex::Print() << "Collision scratch arena: high-water mark " << max_bytes
+                   << " bytes per process (" << total_bytes << " bytes in total), "
+                   << max_buffers << " buffers per thread, "
+                   << n_grows << " allocations for " << n_borrows << " borrowed buffers\n";
+}
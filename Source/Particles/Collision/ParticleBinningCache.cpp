@@ -0,0 +1,38 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "ParticleBinningCache.H"
+
+#include "Utils/ParticleUtils.H"
+
+#include <AMReX_IntVect.H>
+
+ParticleBinningCache::ParticleBins&
+ParticleBinningCache::getBins (WarpXParticleContainer const& species, int lev,
+                               amrex::MFIter const& mfi, ParticleTileType& ptile)
+{
+    const Key key{&species, lev, mfi.index(), mfi.LocalTileIndex()};
+
+    // std::map does not invalidate references when inserting,
+    // so that only the lookup needs to be protected
+    Entry* entry = nullptr;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (particle_binning_cache)
+#endif
+    {
+        entry = &m_entries[key];
+    }
+
+    const amrex::Box cbx = mfi.tilebox(amrex::IntVect::TheZeroVector());
+    const int np = ptile.numParticles();
+    if (entry->generation != m_generation || entry->num_particles != np || entry->box != cbx) {
+        ParticleUtils::findParticlesInEachCell(entry->bins, lev, mfi, ptile);
+        entry->box = cbx;
+        entry->num_particles = np;
+        entry->generation = m_generation;
+    }
+    return entry->bins;
+}
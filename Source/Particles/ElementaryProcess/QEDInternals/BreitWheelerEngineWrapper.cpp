@@ -7,6 +7,8 @@
 #include "BreitWheelerEngineWrapper.H"
 
 #include "Utils/TextMsg.H"
+#include "Utils/WarpXUtil.H"
+#include "Utils/WarpXVersion.H"
 
 #include <AMReX.H>
 #include <AMReX_BLassert.H>
@@ -16,14 +18,17 @@
 //Functions needed to generate a new table
 #ifdef WARPX_QED_TABLE_GEN
 #   include <picsar_qed/physics/breit_wheeler/breit_wheeler_engine_tables_generator.hpp>
+#   include <picsar_qed/physics/breit_wheeler/breit_wheeler_engine_tabulated_functions.hpp>
 #endif
 #include <picsar_qed/utils/serialization.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 using namespace std;
@@ -77,6 +82,16 @@ BreitWheelerEngine::init_lookup_tables_from_raw_data (
     const auto raw_pair_prod_table = vector<char>{
         raw_iter+static_cast<long>(size_first), raw_data.end()};
 
+    return init_lookup_tables_from_raw_data(
+        raw_dndt_table, raw_pair_prod_table, bw_minimum_chi_phot);
+}
+
+bool
+BreitWheelerEngine::init_lookup_tables_from_raw_data (
+    const vector<char>& raw_dndt_table,
+    const vector<char>& raw_pair_prod_table,
+    const amrex::ParticleReal bw_minimum_chi_phot)
+{
     m_dndt_table = BW_dndt_table{raw_dndt_table};
     m_pair_prod_table = BW_pair_prod_table{raw_pair_prod_table};
 
@@ -162,6 +177,105 @@ void BreitWheelerEngine::compute_lookup_tables (
 #endif
 }
 
+// The values of the tables are computed as in the generate() functions of PICSAR,
+// but only at a range of chi points, so that they can be computed by different processes
+
+vector<amrex::ParticleReal>
+BreitWheelerEngine::compute_dndt_lookup_table_values (
+    const PicsarBreitWheelerCtrl& ctrl, const int first, const int count)
+{
+#ifdef WARPX_QED_TABLE_GEN
+    namespace pxr_bw = picsar::multi_physics::phys::breit_wheeler;
+    const auto all_coords = BW_dndt_table{ctrl.dndt_params}.get_all_coordinates();
+    auto vals = vector<amrex::ParticleReal>(count);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < count; ++i){
+        vals[i] = pxr_bw::compute_T_function(all_coords[first+i]);
+    }
+    return vals;
+#else
+    amrex::ignore_unused(ctrl, first, count);
+    WARPX_ABORT_WITH_MESSAGE("WarpX was not compiled with table generation support!");
+    return vector<amrex::ParticleReal>{};
+#endif
+}
+
+vector<amrex::ParticleReal>
+BreitWheelerEngine::compute_pair_prod_lookup_table_values (
+    const PicsarBreitWheelerCtrl& ctrl, const int first, const int count)
+{
+#ifdef WARPX_QED_TABLE_GEN
+    namespace pxr_bw = picsar::multi_physics::phys::breit_wheeler;
+    // The coordinates of the 2D table are stored with chi as slowest index
+    const auto all_coords = BW_pair_prod_table{ctrl.pair_prod_params}.get_all_coordinates();
+    const int how_many_frac = ctrl.pair_prod_params.frac_how_many;
+    auto vals = vector<amrex::ParticleReal>(static_cast<std::size_t>(count)*how_many_frac);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < count; ++i){
+        const auto offset = static_cast<std::size_t>(first+i)*how_many_frac;
+        const auto chi = all_coords[offset][0];
+        auto chis = vector<amrex::ParticleReal>(how_many_frac);
+        for (int j = 0; j < how_many_frac; ++j){
+            chis[j] = all_coords[offset+j][1];
+        }
+        const auto cumulative_prob = pxr_bw::compute_cumulative_prob(chi, chis);
+        std::copy(cumulative_prob.begin(), cumulative_prob.end(),
+            vals.begin() + static_cast<std::ptrdiff_t>(i)*how_many_frac);
+    }
+    return vals;
+#else
+    amrex::ignore_unused(ctrl, first, count);
+    WARPX_ABORT_WITH_MESSAGE("WarpX was not compiled with table generation support!");
+    return vector<amrex::ParticleReal>{};
+#endif
+}
+
+vector<char>
+BreitWheelerEngine::build_dndt_lookup_table_data (
+    const PicsarBreitWheelerCtrl& ctrl, const vector<amrex::ParticleReal>& vals)
+{
+    auto dndt_table = BW_dndt_table{ctrl.dndt_params};
+    dndt_table.set_all_vals(vals);
+    const auto data = dndt_table.serialize();
+    return vector<char>{data.begin(), data.end()};
+}
+
+vector<char>
+BreitWheelerEngine::build_pair_prod_lookup_table_data (
+    const PicsarBreitWheelerCtrl& ctrl, const vector<amrex::ParticleReal>& vals)
+{
+    auto pair_prod_table = BW_pair_prod_table{ctrl.pair_prod_params};
+    pair_prod_table.set_all_vals(vals);
+    const auto data = pair_prod_table.serialize();
+    return vector<char>{data.begin(), data.end()};
+}
+
+std::string
+BreitWheelerEngine::get_lookup_tables_key (const PicsarBreitWheelerCtrl& ctrl)
+{
+    // Version of the layout of the cached tables: increase it when this layout changes
+    constexpr uint64_t table_format_version = 1;
+
+    vector<char> raw{};
+    pxr_sr::put_in(table_format_version, raw);
+    const std::string picsar_version = PICSAR_GIT_VERSION;
+    raw.insert(raw.end(), picsar_version.begin(), picsar_version.end());
+    pxr_sr::put_in(static_cast<uint64_t>(sizeof(amrex::ParticleReal)), raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_phot_min, raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_phot_max, raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_phot_how_many, raw);
+    pxr_sr::put_in(ctrl.pair_prod_params.chi_phot_min, raw);
+    pxr_sr::put_in(ctrl.pair_prod_params.chi_phot_max, raw);
+    pxr_sr::put_in(ctrl.pair_prod_params.chi_phot_how_many, raw);
+    pxr_sr::put_in(ctrl.pair_prod_params.frac_how_many, raw);
+
+    return "bw_" + WarpXUtilIO::HashBinaryData(raw);
+}
+
 void BreitWheelerEngine::init_builtin_dndt_table()
 {
     constexpr auto default_chi_phot_min = 0.02_prt;
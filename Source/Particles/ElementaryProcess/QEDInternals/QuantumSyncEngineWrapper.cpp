@@ -7,6 +7,8 @@
 #include "QuantumSyncEngineWrapper.H"
 
 #include "Utils/TextMsg.H"
+#include "Utils/WarpXUtil.H"
+#include "Utils/WarpXVersion.H"
 
 #include <AMReX.H>
 #include <AMReX_BLassert.H>
@@ -16,14 +18,17 @@
 //Functions needed to generate a new table
 #ifdef WARPX_QED_TABLE_GEN
 #   include <picsar_qed/physics/quantum_sync/quantum_sync_engine_tables_generator.hpp>
+#   include <picsar_qed/physics/quantum_sync/quantum_sync_engine_tabulated_functions.hpp>
 #endif
 #include "picsar_qed/utils/serialization.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 using namespace std;
@@ -76,6 +81,16 @@ QuantumSynchrotronEngine::init_lookup_tables_from_raw_data (
     const auto raw_phot_em_table = vector<char>{
         raw_iter+static_cast<long>(size_first), raw_data.end()};
 
+    return init_lookup_tables_from_raw_data(
+        raw_dndt_table, raw_phot_em_table, qs_minimum_chi_part);
+}
+
+bool
+QuantumSynchrotronEngine::init_lookup_tables_from_raw_data (
+    const vector<char>& raw_dndt_table,
+    const vector<char>& raw_phot_em_table,
+    const amrex::ParticleReal qs_minimum_chi_part)
+{
     m_dndt_table = QS_dndt_table{raw_dndt_table};
     m_phot_em_table = QS_phot_em_table{raw_phot_em_table};
 
@@ -161,6 +176,106 @@ void QuantumSynchrotronEngine::compute_lookup_tables (
 #endif
 }
 
+// The values of the tables are computed as in the generate() functions of PICSAR,
+// but only at a range of chi points, so that they can be computed by different processes
+
+vector<amrex::ParticleReal>
+QuantumSynchrotronEngine::compute_dndt_lookup_table_values (
+    const PicsarQuantumSyncCtrl& ctrl, const int first, const int count)
+{
+#ifdef WARPX_QED_TABLE_GEN
+    namespace pxr_qs = picsar::multi_physics::phys::quantum_sync;
+    const auto all_coords = QS_dndt_table{ctrl.dndt_params}.get_all_coordinates();
+    auto vals = vector<amrex::ParticleReal>(count);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < count; ++i){
+        vals[i] = pxr_qs::compute_G_function(all_coords[first+i]);
+    }
+    return vals;
+#else
+    amrex::ignore_unused(ctrl, first, count);
+    WARPX_ABORT_WITH_MESSAGE("WarpX was not compiled with table generation support!");
+    return vector<amrex::ParticleReal>{};
+#endif
+}
+
+vector<amrex::ParticleReal>
+QuantumSynchrotronEngine::compute_phot_em_lookup_table_values (
+    const PicsarQuantumSyncCtrl& ctrl, const int first, const int count)
+{
+#ifdef WARPX_QED_TABLE_GEN
+    namespace pxr_qs = picsar::multi_physics::phys::quantum_sync;
+    // The coordinates of the 2D table are stored with chi as slowest index
+    const auto all_coords = QS_phot_em_table{ctrl.phot_em_params}.get_all_coordinates();
+    const int how_many_frac = ctrl.phot_em_params.frac_how_many;
+    auto vals = vector<amrex::ParticleReal>(static_cast<std::size_t>(count)*how_many_frac);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < count; ++i){
+        const auto offset = static_cast<std::size_t>(first+i)*how_many_frac;
+        const auto chi = all_coords[offset][0];
+        auto chis = vector<amrex::ParticleReal>(how_many_frac);
+        for (int j = 0; j < how_many_frac; ++j){
+            chis[j] = all_coords[offset+j][1];
+        }
+        const auto cumulative_prob = pxr_qs::compute_cumulative_prob_opt(chi, chis);
+        std::copy(cumulative_prob.begin(), cumulative_prob.end(),
+            vals.begin() + static_cast<std::ptrdiff_t>(i)*how_many_frac);
+    }
+    return vals;
+#else
+    amrex::ignore_unused(ctrl, first, count);
+    WARPX_ABORT_WITH_MESSAGE("WarpX was not compiled with table generation support!");
+    return vector<amrex::ParticleReal>{};
+#endif
+}
+
+vector<char>
+QuantumSynchrotronEngine::build_dndt_lookup_table_data (
+    const PicsarQuantumSyncCtrl& ctrl, const vector<amrex::ParticleReal>& vals)
+{
+    auto dndt_table = QS_dndt_table{ctrl.dndt_params};
+    dndt_table.set_all_vals(vals);
+    const auto data = dndt_table.serialize();
+    return vector<char>{data.begin(), data.end()};
+}
+
+vector<char>
+QuantumSynchrotronEngine::build_phot_em_lookup_table_data (
+    const PicsarQuantumSyncCtrl& ctrl, const vector<amrex::ParticleReal>& vals)
+{
+    auto phot_em_table = QS_phot_em_table{ctrl.phot_em_params};
+    phot_em_table.set_all_vals(vals);
+    const auto data = phot_em_table.serialize();
+    return vector<char>{data.begin(), data.end()};
+}
+
+std::string
+QuantumSynchrotronEngine::get_lookup_tables_key (const PicsarQuantumSyncCtrl& ctrl)
+{
+    // Version of the layout of the cached tables: increase it when this layout changes
+    constexpr uint64_t table_format_version = 1;
+
+    vector<char> raw{};
+    pxr_sr::put_in(table_format_version, raw);
+    const std::string picsar_version = PICSAR_GIT_VERSION;
+    raw.insert(raw.end(), picsar_version.begin(), picsar_version.end());
+    pxr_sr::put_in(static_cast<uint64_t>(sizeof(amrex::ParticleReal)), raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_part_min, raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_part_max, raw);
+    pxr_sr::put_in(ctrl.dndt_params.chi_part_how_many, raw);
+    pxr_sr::put_in(ctrl.phot_em_params.chi_part_min, raw);
+    pxr_sr::put_in(ctrl.phot_em_params.chi_part_max, raw);
+    pxr_sr::put_in(ctrl.phot_em_params.frac_min, raw);
+    pxr_sr::put_in(ctrl.phot_em_params.chi_part_how_many, raw);
+    pxr_sr::put_in(ctrl.phot_em_params.frac_how_many, raw);
+
+    return "qs_" + WarpXUtilIO::HashBinaryData(raw);
+}
+
 void QuantumSynchrotronEngine::init_builtin_dndt_table()
 {
     constexpr auto default_chi_part_min = 1.0e-3_prt;
@@ -11,6 +11,7 @@
 #include "Evolve/WarpXDtType.H"
 #include "Evolve/WarpXPushType.H"
 #include "Laser/LaserProfiles.H"
+#include "Particles/Deposition/DepositionTiles.H"
 #include "Particles/LaserParticleContainer.H"
 #include "Particles/Pusher/GetAndSetPosition.H"
 #include "Particles/WarpXParticleContainer.H"
@@ -21,6 +22,7 @@
 #include "Utils/WarpXProfilerWrapper.H"
 #include "WarpX.H"
 
+#include <ablastr/utils/counters/Counters.H>
 #include <ablastr/warn_manager/WarnManager.H>
 
 #include <AMReX.H>
@@ -579,14 +581,18 @@ LaserParticleContainer::Evolve (int lev,
         t_lab = 1._rt/WarpX::gamma_boost*t + WarpX::beta_boost*m_Z0_lab/PhysConst::c;
     }
 
-    // Update laser profile
-    m_up_laser_profile->update(t_lab);
+    // Update laser profile (once per step, when the tiles are processed in two passes)
+    if (m_deposition_tiles != DepositionTiles::Interior) {
+        m_up_laser_profile->update(t_lab);
+    }
 
     BL_ASSERT(OnSameGrids(lev,jx));
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
     const bool has_buffer = cjx;
+    const amrex::IntVect interior_margin_J = (m_deposition_tiles == DepositionTiles::All) ?
+        amrex::IntVect(0) : WarpX::GetInstance().getInteriorTileMarginJ(lev);
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -600,9 +606,17 @@ LaserParticleContainer::Evolve (int lev,
 
         Gpu::DeviceVector<Real> plane_Xp, plane_Yp, amplitude_E;
 
+        // deposition time of this thread, for the performance counters
+        double deposition_time = 0.0;
+
         for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
         {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (!DepositionTilesUtils::isSelected(m_deposition_tiles,
+                                                  pti.tilebox(), pti.validbox(), interior_margin_J)) {
+                continue;
+            }
+
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
             }
@@ -627,6 +641,7 @@ LaserParticleContainer::Evolve (int lev,
             }
 
             if (rho && ! skip_deposition && ! do_not_deposit) {
+                const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
                 int* AMREX_RESTRICT ion_lev = nullptr;
                 DepositCharge(pti, wp, ion_lev, rho, 0, 0,
                               np_current, thread_num, lev, lev);
@@ -660,6 +675,8 @@ LaserParticleContainer::Evolve (int lev,
             // Current Deposition
             if (!skip_deposition)
             {
+                const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
+
                 // Deposit at t_{n+1/2}
                 const amrex::Real relative_time = -0.5_rt * dt;
 
@@ -680,6 +697,7 @@ LaserParticleContainer::Evolve (int lev,
 
 
             if (rho && ! skip_deposition && ! do_not_deposit) {
+                const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
                 int* AMREX_RESTRICT ion_lev = nullptr;
                 DepositCharge(pti, wp, ion_lev, rho, 1, 0,
                               np_current, thread_num, lev, lev);
@@ -692,12 +710,16 @@ LaserParticleContainer::Evolve (int lev,
             // This is necessary because of plane_Xp, plane_Yp and amplitude_E
             amrex::Gpu::synchronize();
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 wt = static_cast<Real>(amrex::second()) - wt;
                 amrex::HostDevice::Atomic::Add( &(*cost)[pti.index()], wt);
             }
         }
+
+        if (ablastr::utils::counters::Enabled()) {
+            ablastr::utils::counters::Add(DepositionCounterName(lev), deposition_time);
+        }
     }
 }
 
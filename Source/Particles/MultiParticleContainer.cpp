@@ -45,6 +45,7 @@
 #include "WarpX.H"
 
 #include <ablastr/utils/Communication.H>
+#include <ablastr/utils/counters/Counters.H>
 #include <ablastr/warn_manager/WarnManager.H>
 
 #include <AMReX.H>
@@ -73,8 +74,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -89,6 +93,92 @@ namespace
     {
         Array4< amrex::Real const > const Ex, Ey, Ez, Bx, By, Bz;
     };
+
+#ifdef WARPX_QED
+    /** Broadcast the binary data of a QED lookup table from the process root */
+    void BcastQedTableData (std::vector<char>& data, int root)
+    {
+        auto size = static_cast<Long>(data.size());
+        ParallelDescriptor::Bcast(&size, 1, root);
+        data.resize(size);
+        ParallelDescriptor::Bcast(data.data(), data.size(), root);
+    }
+
+    /** Compute the values of a QED lookup table with all the processes, and gather them
+     *  on the I/O processor. Each process computes the values at a range of chi points.
+     *
+     * @param[in] how_many_chi number of chi points of the table
+     * @param[in] vals_per_chi number of values of the table per chi point
+     * @param[in] compute_vals function computing the values at the chi points [first, first+count)
+     * @return all the values of the table on the I/O processor (empty on the other processes)
+     */
+    template <typename ComputeVals>
+    std::vector<ParticleReal> GatherQedTableValues (
+        int how_many_chi, int vals_per_chi, ComputeVals const& compute_vals)
+    {
+        const int nprocs = ParallelDescriptor::NProcs();
+        std::vector<int> recvcount(nprocs, 0);
+        std::vector<int> disp(nprocs, 0);
+        for (int i = 0; i < nprocs; ++i) {
+            const auto first = static_cast<int>(static_cast<Long>(how_many_chi)*i/nprocs);
+            const auto last = static_cast<int>(static_cast<Long>(how_many_chi)*(i+1)/nprocs);
+            recvcount[i] = (last - first)*vals_per_chi;
+            disp[i] = first*vals_per_chi;
+        }
+        const int myproc = ParallelDescriptor::MyProc();
+        const auto local_vals = compute_vals(disp[myproc]/vals_per_chi, recvcount[myproc]/vals_per_chi);
+
+        std::vector<ParticleReal> vals;
+        if (ParallelDescriptor::IOProcessor()) {
+            vals.resize(static_cast<std::size_t>(how_many_chi)*vals_per_chi);
+        }
+        ParallelDescriptor::Gatherv(local_vals.data(), recvcount[myproc], vals.data(), recvcount, disp,
+                                    ParallelDescriptor::IOProcessorNumber());
+        return vals;
+    }
+
+    /** Path of the cached QED lookup tables identified by key (empty if the cache is disabled) */
+    std::string QedTableCacheFile (const ParmParse& pp, const std::string& key)
+    {
+        std::string cache_dir;
+        pp.query("table_cache_dir", cache_dir);
+        if (cache_dir.empty()) { return cache_dir; }
+        return cache_dir + "/" + key + ".bin";
+    }
+
+    /** Read cached QED lookup tables on all processes, if the cache file exists */
+    bool ReadQedTableCache (const std::string& cache_file, Vector<char>& table_data)
+    {
+        if (cache_file.empty()) { return false; }
+        int is_cached = 0;
+        if (ParallelDescriptor::IOProcessor()) {
+            is_cached = static_cast<int>(amrex::FileExists(cache_file));
+        }
+        ParallelDescriptor::Bcast(&is_cached, 1, ParallelDescriptor::IOProcessorNumber());
+        if (is_cached == 0) { return false; }
+        ParallelDescriptor::ReadAndBcastFile(cache_file, table_data);
+        return true;
+    }
+
+    /** Write QED lookup tables in the cache (on the I/O processor only)
+     *
+     * The file is written under a temporary name and then renamed, so that concurrent
+     * simulations sharing the cache never read a partially written file.
+     */
+    void WriteQedTableCache (const std::string& cache_file, const Vector<char>& table_data)
+    {
+        if (cache_file.empty() || !ParallelDescriptor::IOProcessor()) { return; }
+        const auto cache_dir = cache_file.substr(0, cache_file.rfind('/'));
+        if (!amrex::UtilCreateDirectory(cache_dir, 0755)) {
+            amrex::CreateDirectoryFailed(cache_dir);
+        }
+        const auto tmp_file = cache_file + ".tmp" + std::to_string(std::random_device{}());
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            WarpXUtilIO::WriteBinaryDataOnFile(tmp_file, table_data) &&
+            std::rename(tmp_file.c_str(), cache_file.c_str()) == 0,
+            "Failed to write the QED lookup tables in the cache file " + cache_file);
+    }
+#endif
 }
 
 MultiParticleContainer::MultiParticleContainer (AmrCore* amr_core)
@@ -466,9 +556,9 @@ MultiParticleContainer::Evolve (int lev,
                                 const MultiFab* cEx, const MultiFab* cEy, const MultiFab* cEz,
                                 const MultiFab* cBx, const MultiFab* cBy, const MultiFab* cBz,
                                 Real t, Real dt, DtType a_dt_type, bool skip_deposition,
-                                PushType push_type)
+                                PushType push_type, DepositionTiles tiles)
 {
-    if (! skip_deposition) {
+    if (! skip_deposition && tiles != DepositionTiles::Interior) {
         jx.setVal(0.0);
         jy.setVal(0.0);
         jz.setVal(0.0);
@@ -479,8 +569,10 @@ MultiParticleContainer::Evolve (int lev,
         if (crho) { crho->setVal(0.0); }
     }
     for (auto& pc : allcontainers) {
+        pc->setDepositionTiles(tiles);
         pc->Evolve(lev, Ex, Ey, Ez, Bx, By, Bz, jx, jy, jz, cjx, cjy, cjz,
                    rho, crho, cEx, cEy, cEz, cBx, cBy, cBz, t, dt, a_dt_type, skip_deposition, push_type);
+        pc->setDepositionTiles(DepositionTiles::All);
     }
 }
 
@@ -629,6 +721,7 @@ MultiParticleContainer::SortParticlesByBin (amrex::IntVect bin_size)
 void
 MultiParticleContainer::Redistribute ()
 {
+    CountRedistributedParticles();
     for (auto& pc : allcontainers) {
         pc->Redistribute();
     }
@@ -653,11 +746,24 @@ MultiParticleContainer::deleteInvalidParticles ()
 void
 MultiParticleContainer::RedistributeLocal (const int num_ghost)
 {
+    CountRedistributedParticles();
     for (auto& pc : allcontainers) {
         pc->Redistribute(0, 0, 0, num_ghost);
     }
 }
 
+void
+MultiParticleContainer::CountRedistributedParticles () const
+{
+    if (!ablastr::utils::counters::Enabled()) { return; }
+
+    amrex::Long np = 0;
+    for (auto const& pc : allcontainers) {
+        np += pc->TotalNumberOfParticles(true, true);
+    }
+    ablastr::utils::counters::Add("particles_redistributed", static_cast<double>(np));
+}
+
 void
 MultiParticleContainer::ApplyBoundaryConditions ()
 {
@@ -905,7 +1011,7 @@ MultiParticleContainer::doFieldIonization (int lev,
 #endif
         for (WarpXParIter pti(*pc_source, lev, info); pti.isValid(); ++pti)
         {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
             }
@@ -924,7 +1030,7 @@ MultiParticleContainer::doFieldIonization (int lev,
 
             setNewParticleIDs(dst_tile, np_dst, num_added);
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
                 wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -941,6 +1047,29 @@ MultiParticleContainer::doCollisions ( Real cur_time, amrex::Real dt )
     collisionhandler->doCollisions(cur_time, dt, this);
 }
 
+void
+MultiParticleContainer::PrintCollisionScratchStatistics () const
+{
+    collisionhandler->PrintScratchStatistics();
+}
+
+std::vector<std::vector<int>>
+MultiParticleContainer::GetCollisionSpeciesIDs () const
+{
+    std::vector<std::vector<int>> species_ids;
+    for (auto const& collision_species : collisionhandler->GetCollisionSpeciesNames()) {
+        std::vector<int> ids;
+        for (auto const& name : collision_species) {
+            auto const it = std::find(species_names.begin(), species_names.end(), name);
+            if (it != species_names.end()) {
+                ids.push_back(static_cast<int>(std::distance(species_names.begin(), it)));
+            }
+        }
+        species_ids.push_back(ids);
+    }
+    return species_ids;
+}
+
 void MultiParticleContainer::doResampling (const int timestep, const bool verbose)
 {
     for (auto& pc : allcontainers)
@@ -1149,77 +1278,100 @@ MultiParticleContainer::QuantumSyncGenerateTable ()
     amrex::Real qs_minimum_chi_part;
     utils::parser::getWithParser(pp_qed_qs, "chi_min", qs_minimum_chi_part);
 
-    if(ParallelDescriptor::IOProcessor()){
-        PicsarQuantumSyncCtrl ctrl;
-
-        //==Table parameters==
-
-        //--- sub-table 1 (1D)
-        //These parameters are used to pre-compute a function
-        //which appears in the evolution of the optical depth
-
-        //Minimun chi for the table. If a lepton has chi < tab_dndt_chi_min,
-        //chi is considered as if it were equal to tab_dndt_chi_min
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_chi_min", ctrl.dndt_params.chi_part_min);
-
-        //Maximum chi for the table. If a lepton has chi > tab_dndt_chi_max,
-        //chi is considered as if it were equal to tab_dndt_chi_max
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_chi_max", ctrl.dndt_params.chi_part_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_how_many", ctrl.dndt_params.chi_part_how_many);
-        //------
-
-        //--- sub-table 2 (2D)
-        //These parameters are used to pre-compute a function
-        //which is used to extract the properties of the generated
-        //photons.
-
-        //Minimun chi for the table. If a lepton has chi < tab_em_chi_min,
-        //chi is considered as if it were equal to tab_em_chi_min
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_min", ctrl.phot_em_params.chi_part_min);
-
-        //Maximum chi for the table. If a lepton has chi > tab_em_chi_max,
-        //chi is considered as if it were equal to tab_em_chi_max
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_max", ctrl.phot_em_params.chi_part_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_how_many", ctrl.phot_em_params.chi_part_how_many);
-
-        //The other axis of the table is the ratio between the quantum
-        //parameter of the emitted photon and the quantum parameter of the
-        //lepton. This parameter is the minimum ratio to consider for the table.
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_frac_min", ctrl.phot_em_params.frac_min);
-
-        //This parameter is the number of different points to consider for the second
-        //axis
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_frac_how_many", ctrl.phot_em_params.frac_how_many);
-        //====================
-
-        m_shr_p_qs_engine->compute_lookup_tables(ctrl, qs_minimum_chi_part);
-        const auto data = m_shr_p_qs_engine->export_lookup_tables_data();
-        WarpXUtilIO::WriteBinaryDataOnFile(table_name,
-            Vector<char>{data.begin(), data.end()});
-    }
-
-    ParallelDescriptor::Barrier();
+    PicsarQuantumSyncCtrl ctrl;
+
+    //==Table parameters==
+
+    //--- sub-table 1 (1D)
+    //These parameters are used to pre-compute a function
+    //which appears in the evolution of the optical depth
+
+    //Minimun chi for the table. If a lepton has chi < tab_dndt_chi_min,
+    //chi is considered as if it were equal to tab_dndt_chi_min
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_chi_min", ctrl.dndt_params.chi_part_min);
+
+    //Maximum chi for the table. If a lepton has chi > tab_dndt_chi_max,
+    //chi is considered as if it were equal to tab_dndt_chi_max
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_chi_max", ctrl.dndt_params.chi_part_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_how_many", ctrl.dndt_params.chi_part_how_many);
+    //------
+
+    //--- sub-table 2 (2D)
+    //These parameters are used to pre-compute a function
+    //which is used to extract the properties of the generated
+    //photons.
+
+    //Minimun chi for the table. If a lepton has chi < tab_em_chi_min,
+    //chi is considered as if it were equal to tab_em_chi_min
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_min", ctrl.phot_em_params.chi_part_min);
+
+    //Maximum chi for the table. If a lepton has chi > tab_em_chi_max,
+    //chi is considered as if it were equal to tab_em_chi_max
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_max", ctrl.phot_em_params.chi_part_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_how_many", ctrl.phot_em_params.chi_part_how_many);
+
+    //The other axis of the table is the ratio between the quantum
+    //parameter of the emitted photon and the quantum parameter of the
+    //lepton. This parameter is the minimum ratio to consider for the table.
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_frac_min", ctrl.phot_em_params.frac_min);
+
+    //This parameter is the number of different points to consider for the second
+    //axis
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_frac_how_many", ctrl.phot_em_params.frac_how_many);
+    //====================
+
+    // The tables are loaded from the cache if they have already been generated
+    // with the same parameters
+    const auto cache_file = QedTableCacheFile(pp_qed_qs, QuantumSynchrotronEngine::get_lookup_tables_key(ctrl));
     Vector<char> table_data;
-    ParallelDescriptor::ReadAndBcastFile(table_name, table_data);
-    ParallelDescriptor::Barrier();
+    const bool is_cached = ReadQedTableCache(cache_file, table_data) &&
+        m_shr_p_qs_engine->init_lookup_tables_from_raw_data(table_data, qs_minimum_chi_part);
 
-    //No need to initialize from raw data for the processor that
-    //has just generated the table
-    if(!ParallelDescriptor::IOProcessor()){
-        m_shr_p_qs_engine->init_lookup_tables_from_raw_data(
-            table_data, qs_minimum_chi_part);
+    if (is_cached) {
+        ablastr::warn_manager::WMRecordWarning("QED",
+            "The Quantum Synchrotron table has been read from the cache file: " + cache_file,
+            ablastr::warn_manager::WarnPriority::low);
+    }
+    else {
+        // The values of the tables at different chi points are independent: they are computed
+        // by all the processes and gathered on the I/O processor, which broadcasts the tables
+        const auto dndt_vals = GatherQedTableValues(ctrl.dndt_params.chi_part_how_many, 1,
+            [&ctrl](int first, int count){
+                return QuantumSynchrotronEngine::compute_dndt_lookup_table_values(ctrl, first, count); });
+        const auto phot_em_vals = GatherQedTableValues(ctrl.phot_em_params.chi_part_how_many,
+            ctrl.phot_em_params.frac_how_many,
+            [&ctrl](int first, int count){
+                return QuantumSynchrotronEngine::compute_phot_em_lookup_table_values(ctrl, first, count); });
+        std::vector<char> dndt_data;
+        std::vector<char> phot_em_data;
+        if (ParallelDescriptor::IOProcessor()) {
+            dndt_data = QuantumSynchrotronEngine::build_dndt_lookup_table_data(ctrl, dndt_vals);
+            phot_em_data = QuantumSynchrotronEngine::build_phot_em_lookup_table_data(ctrl, phot_em_vals);
+        }
+        BcastQedTableData(dndt_data, ParallelDescriptor::IOProcessorNumber());
+        BcastQedTableData(phot_em_data, ParallelDescriptor::IOProcessorNumber());
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            m_shr_p_qs_engine->init_lookup_tables_from_raw_data(dndt_data, phot_em_data, qs_minimum_chi_part),
+            "Failed to initialize the generated Quantum Synchrotron table");
+    }
+
+    if (ParallelDescriptor::IOProcessor()) {
+        const auto data = m_shr_p_qs_engine->export_lookup_tables_data();
+        table_data = Vector<char>{data.begin(), data.end()};
+        WarpXUtilIO::WriteBinaryDataOnFile(table_name, table_data);
+        if (!is_cached) { WriteQedTableCache(cache_file, table_data); }
     }
 }
 
@@ -1239,72 +1391,95 @@ MultiParticleContainer::BreitWheelerGenerateTable ()
     amrex::Real bw_minimum_chi_part;
     utils::parser::getWithParser(pp_qed_bw, "chi_min", bw_minimum_chi_part);
 
-    if(ParallelDescriptor::IOProcessor()){
-        PicsarBreitWheelerCtrl ctrl;
-
-        //==Table parameters==
-
-        //--- sub-table 1 (1D)
-        //These parameters are used to pre-compute a function
-        //which appears in the evolution of the optical depth
-
-        //Minimun chi for the table. If a photon has chi < tab_dndt_chi_min,
-        //an analytical approximation is used.
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_chi_min", ctrl.dndt_params.chi_phot_min);
-
-        //Maximum chi for the table. If a photon has chi > tab_dndt_chi_max,
-        //an analytical approximation is used.
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_chi_max", ctrl.dndt_params.chi_phot_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_how_many", ctrl.dndt_params.chi_phot_how_many);
-        //------
-
-        //--- sub-table 2 (2D)
-        //These parameters are used to pre-compute a function
-        //which is used to extract the properties of the generated
-        //particles.
-
-        //Minimun chi for the table. If a photon has chi < tab_pair_chi_min
-        //chi is considered as it were equal to chi_phot_tpair_min
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_min", ctrl.pair_prod_params.chi_phot_min);
-
-        //Maximum chi for the table. If a photon has chi > tab_pair_chi_max
-        //chi is considered as it were equal to chi_phot_tpair_max
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_max", ctrl.pair_prod_params.chi_phot_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_how_many", ctrl.pair_prod_params.chi_phot_how_many);
-
-        //The other axis of the table is the fraction of the initial energy
-        //'taken away' by the most energetic particle of the pair.
-        //This parameter is the number of different fractions to consider
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_frac_how_many", ctrl.pair_prod_params.frac_how_many);
-        //====================
-
-        m_shr_p_bw_engine->compute_lookup_tables(ctrl, bw_minimum_chi_part);
-        const auto data = m_shr_p_bw_engine->export_lookup_tables_data();
-        WarpXUtilIO::WriteBinaryDataOnFile(table_name,
-            Vector<char>{data.begin(), data.end()});
-    }
-
-    ParallelDescriptor::Barrier();
+    PicsarBreitWheelerCtrl ctrl;
+
+    //==Table parameters==
+
+    //--- sub-table 1 (1D)
+    //These parameters are used to pre-compute a function
+    //which appears in the evolution of the optical depth
+
+    //Minimun chi for the table. If a photon has chi < tab_dndt_chi_min,
+    //an analytical approximation is used.
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_chi_min", ctrl.dndt_params.chi_phot_min);
+
+    //Maximum chi for the table. If a photon has chi > tab_dndt_chi_max,
+    //an analytical approximation is used.
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_chi_max", ctrl.dndt_params.chi_phot_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_how_many", ctrl.dndt_params.chi_phot_how_many);
+    //------
+
+    //--- sub-table 2 (2D)
+    //These parameters are used to pre-compute a function
+    //which is used to extract the properties of the generated
+    //particles.
+
+    //Minimun chi for the table. If a photon has chi < tab_pair_chi_min
+    //chi is considered as it were equal to chi_phot_tpair_min
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_min", ctrl.pair_prod_params.chi_phot_min);
+
+    //Maximum chi for the table. If a photon has chi > tab_pair_chi_max
+    //chi is considered as it were equal to chi_phot_tpair_max
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_max", ctrl.pair_prod_params.chi_phot_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_how_many", ctrl.pair_prod_params.chi_phot_how_many);
+
+    //The other axis of the table is the fraction of the initial energy
+    //'taken away' by the most energetic particle of the pair.
+    //This parameter is the number of different fractions to consider
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_frac_how_many", ctrl.pair_prod_params.frac_how_many);
+    //====================
+
+    // The tables are loaded from the cache if they have already been generated
+    // with the same parameters
+    const auto cache_file = QedTableCacheFile(pp_qed_bw, BreitWheelerEngine::get_lookup_tables_key(ctrl));
     Vector<char> table_data;
-    ParallelDescriptor::ReadAndBcastFile(table_name, table_data);
-    ParallelDescriptor::Barrier();
+    const bool is_cached = ReadQedTableCache(cache_file, table_data) &&
+        m_shr_p_bw_engine->init_lookup_tables_from_raw_data(table_data, bw_minimum_chi_part);
 
-    //No need to initialize from raw data for the processor that
-    //has just generated the table
-    if(!ParallelDescriptor::IOProcessor()){
-        m_shr_p_bw_engine->init_lookup_tables_from_raw_data(
-            table_data, bw_minimum_chi_part);
+    if (is_cached) {
+        ablastr::warn_manager::WMRecordWarning("QED",
+            "The Breit Wheeler table has been read from the cache file: " + cache_file,
+            ablastr::warn_manager::WarnPriority::low);
+    }
+    else {
+        // The values of the tables at different chi points are independent: they are computed
+        // by all the processes and gathered on the I/O processor, which broadcasts the tables
+        const auto dndt_vals = GatherQedTableValues(ctrl.dndt_params.chi_phot_how_many, 1,
+            [&ctrl](int first, int count){
+                return BreitWheelerEngine::compute_dndt_lookup_table_values(ctrl, first, count); });
+        const auto pair_prod_vals = GatherQedTableValues(ctrl.pair_prod_params.chi_phot_how_many,
+            ctrl.pair_prod_params.frac_how_many,
+            [&ctrl](int first, int count){
+                return BreitWheelerEngine::compute_pair_prod_lookup_table_values(ctrl, first, count); });
+        std::vector<char> dndt_data;
+        std::vector<char> pair_prod_data;
+        if (ParallelDescriptor::IOProcessor()) {
+            dndt_data = BreitWheelerEngine::build_dndt_lookup_table_data(ctrl, dndt_vals);
+            pair_prod_data = BreitWheelerEngine::build_pair_prod_lookup_table_data(ctrl, pair_prod_vals);
+        }
+        BcastQedTableData(dndt_data, ParallelDescriptor::IOProcessorNumber());
+        BcastQedTableData(pair_prod_data, ParallelDescriptor::IOProcessorNumber());
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            m_shr_p_bw_engine->init_lookup_tables_from_raw_data(dndt_data, pair_prod_data, bw_minimum_chi_part),
+            "Failed to initialize the generated Breit Wheeler table");
+    }
+
+    if (ParallelDescriptor::IOProcessor()) {
+        const auto data = m_shr_p_bw_engine->export_lookup_tables_data();
+        table_data = Vector<char>{data.begin(), data.end()};
+        WarpXUtilIO::WriteBinaryDataOnFile(table_name, table_data);
+        if (!is_cached) { WriteQedTableCache(cache_file, table_data); }
     }
 }
 
@@ -1538,7 +1713,7 @@ void MultiParticleContainer::doQedBreitWheeler (int lev,
 #endif
         for (WarpXParIter pti(*pc_source, lev, info); pti.isValid(); ++pti)
         {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
             }
@@ -1565,7 +1740,7 @@ void MultiParticleContainer::doQedBreitWheeler (int lev,
             setNewParticleIDs(dst_ele_tile, np_dst_ele, num_added);
             setNewParticleIDs(dst_pos_tile, np_dst_pos, num_added);
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
                 wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -1615,7 +1790,7 @@ void MultiParticleContainer::doQedQuantumSync (int lev,
 #endif
         for (WarpXParIter pti(*pc_source, lev, info); pti.isValid(); ++pti)
         {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
             }
@@ -1646,7 +1821,7 @@ void MultiParticleContainer::doQedQuantumSync (int lev,
                                   dst_tile, np_dst, num_added,
                                   m_quantum_sync_photon_creation_energy_threshold);
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
                 wt = static_cast<amrex::Real>(amrex::second()) - wt;
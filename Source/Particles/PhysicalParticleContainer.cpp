@@ -16,6 +16,9 @@
 #include "Initialization/InjectorPosition.H"
 #include "MultiParticleContainer.H"
 #include "Particles/AddPlasmaUtilities.H"
+#include "Particles/Deposition/ColoredTiles.H"
+#include "Particles/Deposition/DepositionTiles.H"
+#include "Particles/Deposition/CurrentDeposition.H"
 #ifdef WARPX_QED
 #   include "Particles/ElementaryProcess/QEDInternals/BreitWheelerEngineWrapper.H"
 #   include "Particles/ElementaryProcess/QEDInternals/QuantumSyncEngineWrapper.H"
@@ -25,6 +28,7 @@
 #include "Particles/ParticleCreation/DefaultInitialization.H"
 #include "Particles/Pusher/CopyParticleAttribs.H"
 #include "Particles/Pusher/GetAndSetPosition.H"
+#include "Particles/Pusher/PushCompileTimeOptions.H"
 #include "Particles/Pusher/PushSelector.H"
 #include "Particles/Pusher/UpdateMomentumBoris.H"
 #include "Particles/Pusher/UpdateMomentumBorisWithRadiationReaction.H"
@@ -47,6 +51,7 @@
 #endif
 #include "WarpX.H"
 
+#include <ablastr/utils/counters/Counters.H>
 #include <ablastr/warn_manager/WarnManager.H>
 
 #include <AMReX.H>
@@ -108,6 +113,7 @@
 #include <cstdlib>
 #include <limits>
 #include <map>
+#include <optional>
 #include <random>
 #include <string>
 #include <utility>
@@ -999,7 +1005,7 @@ PhysicalParticleContainer::AddPlasma (PlasmaInjector const& plasma_injector, int
 #endif
     for (MFIter mfi = MakeMFIter(lev, info); mfi.isValid(); ++mfi)
     {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -1332,7 +1338,7 @@ PhysicalParticleContainer::AddPlasma (PlasmaInjector const& plasma_injector, int
 
         amrex::Gpu::synchronize();
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
             amrex::HostDevice::Atomic::Add( &(*cost)[mfi.index()], wt);
@@ -1410,7 +1416,7 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 #endif
     for (MFIter mfi = MakeMFIter(0, info); mfi.isValid(); ++mfi)
     {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
@@ -1712,7 +1718,7 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 
         amrex::Gpu::synchronize();
 
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
             amrex::HostDevice::Atomic::Add( &(*cost)[mfi.index()], wt);
@@ -1776,224 +1782,294 @@ PhysicalParticleContainer::Evolve (int lev,
         }
     }
 
+    // With colored tiles (CPU only), the tiles are processed in several passes,
+    // such that concurrent tiles do not deposit in the same cells
+    const WarpX& warpx = WarpX::GetInstance();
+    const bool colored_tiles = WarpX::do_colored_tile_deposition && do_tiling &&
+        Gpu::notInLaunchRegion() && !skip_deposition && !do_not_deposit;
+    if (colored_tiles) {
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            ColoredTiles::isRaceFree(tile_size, warpx.get_ng_depos_J()) &&
+            ColoredTiles::isRaceFree(tile_size, warpx.get_ng_depos_rho()),
+            "warpx.do_colored_tile_deposition requires particles.tile_size to be larger "
+            "than twice the number of guard cells used for deposition");
+    }
+    m_deposit_in_place = colored_tiles;
+    const int n_colors = colored_tiles ? ColoredTiles::n_colors : 1;
+    const amrex::IntVect interior_margin_J = (m_deposition_tiles == DepositionTiles::All) ?
+        amrex::IntVect(0) : warpx.getInteriorTileMarginJ(lev);
+
+    for (int color = 0; color < n_colors; ++color)
+    {
 #ifdef AMREX_USE_OMP
 #pragma omp parallel
 #endif
-    {
+        {
 #ifdef AMREX_USE_OMP
-        const int thread_num = omp_get_thread_num();
+            const int thread_num = omp_get_thread_num();
 #else
-        const int thread_num = 0;
+            const int thread_num = 0;
 #endif
 
-        FArrayBox filtered_Ex, filtered_Ey, filtered_Ez;
-        FArrayBox filtered_Bx, filtered_By, filtered_Bz;
+            FArrayBox filtered_Ex, filtered_Ey, filtered_Ez;
+            FArrayBox filtered_Bx, filtered_By, filtered_Bz;
 
-        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
-        {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            // number of particles pushed and deposition time of this thread, for the performance counters
+            amrex::Long np_pushed = 0;
+            double deposition_time = 0.0;
+
+            for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
             {
-                amrex::Gpu::synchronize();
-            }
-            auto wt = static_cast<amrex::Real>(amrex::second());
+                if (colored_tiles &&
+                    ColoredTiles::tileColor(pti.tilebox(), pti.validbox(), tile_size) != color) {
+                    continue;
+                }
+                if (!DepositionTilesUtils::isSelected(m_deposition_tiles,
+                                                      pti.tilebox(), pti.validbox(), interior_margin_J)) {
+                    continue;
+                }
 
-            const Box& box = pti.validbox();
+                if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
+                {
+                    amrex::Gpu::synchronize();
+                }
+                auto wt = static_cast<amrex::Real>(amrex::second());
 
-            // Extract particle data
-            auto& attribs = pti.GetAttribs();
-            auto&  wp = attribs[PIdx::w];
-            auto& uxp = attribs[PIdx::ux];
-            auto& uyp = attribs[PIdx::uy];
-            auto& uzp = attribs[PIdx::uz];
+                const Box& box = pti.validbox();
 
-            const long np = pti.numParticles();
+                // Extract particle data
+                auto& attribs = pti.GetAttribs();
+                auto&  wp = attribs[PIdx::w];
+                auto& uxp = attribs[PIdx::ux];
+                auto& uyp = attribs[PIdx::uy];
+                auto& uzp = attribs[PIdx::uz];
 
-            // Data on the grid
-            FArrayBox const* exfab = &Ex[pti];
-            FArrayBox const* eyfab = &Ey[pti];
-            FArrayBox const* ezfab = &Ez[pti];
-            FArrayBox const* bxfab = &Bx[pti];
-            FArrayBox const* byfab = &By[pti];
-            FArrayBox const* bzfab = &Bz[pti];
+                const long np = pti.numParticles();
 
-            Elixir exeli, eyeli, ezeli, bxeli, byeli, bzeli;
+                // Data on the grid
+                FArrayBox const* exfab = &Ex[pti];
+                FArrayBox const* eyfab = &Ey[pti];
+                FArrayBox const* ezfab = &Ez[pti];
+                FArrayBox const* bxfab = &Bx[pti];
+                FArrayBox const* byfab = &By[pti];
+                FArrayBox const* bzfab = &Bz[pti];
 
-            if (WarpX::use_fdtd_nci_corr)
-            {
-                // Filter arrays Ex[pti], store the result in
-                // filtered_Ex and update pointer exfab so that it
-                // points to filtered_Ex (and do the same for all
-                // components of E and B).
-                applyNCIFilter(lev, pti.tilebox(), exeli, eyeli, ezeli, bxeli, byeli, bzeli,
-                               filtered_Ex, filtered_Ey, filtered_Ez,
-                               filtered_Bx, filtered_By, filtered_Bz,
-                               Ex[pti], Ey[pti], Ez[pti], Bx[pti], By[pti], Bz[pti],
-                               exfab, eyfab, ezfab, bxfab, byfab, bzfab);
-            }
+                Elixir exeli, eyeli, ezeli, bxeli, byeli, bzeli;
 
-            // Determine which particles deposit/gather in the buffer, and
-            // which particles deposit/gather in the fine patch
-            long nfine_current = np;
-            long nfine_gather = np;
-            if (has_buffer && !do_not_push) {
-                // - Modify `nfine_current` and `nfine_gather` (in place)
-                //    so that they correspond to the number of particles
-                //    that deposit/gather in the fine patch respectively.
-                // - Reorder the particle arrays,
-                //    so that the `nfine_current`/`nfine_gather` first particles
-                //    deposit/gather in the fine patch
-                //    and (thus) the `np-nfine_current`/`np-nfine_gather` last particles
-                //    deposit/gather in the buffer
-                PartitionParticlesInBuffers( nfine_current, nfine_gather, np,
-                    pti, lev, current_masks, gather_masks );
-            }
+                if (WarpX::use_fdtd_nci_corr)
+                {
+                    // Filter arrays Ex[pti], store the result in
+                    // filtered_Ex and update pointer exfab so that it
+                    // points to filtered_Ex (and do the same for all
+                    // components of E and B).
+                    applyNCIFilter(lev, pti.tilebox(), exeli, eyeli, ezeli, bxeli, byeli, bzeli,
+                                   filtered_Ex, filtered_Ey, filtered_Ez,
+                                   filtered_Bx, filtered_By, filtered_Bz,
+                                   Ex[pti], Ey[pti], Ez[pti], Bx[pti], By[pti], Bz[pti],
+                                   exfab, eyfab, ezfab, bxfab, byfab, bzfab);
+                }
 
-            const long np_current = (cjx) ? nfine_current : np;
+                // Determine which particles deposit/gather in the buffer, and
+                // which particles deposit/gather in the fine patch
+                long nfine_current = np;
+                long nfine_gather = np;
+                if (has_buffer && !do_not_push) {
+                    // - Modify `nfine_current` and `nfine_gather` (in place)
+                    //    so that they correspond to the number of particles
+                    //    that deposit/gather in the fine patch respectively.
+                    // - Reorder the particle arrays,
+                    //    so that the `nfine_current`/`nfine_gather` first particles
+                    //    deposit/gather in the fine patch
+                    //    and (thus) the `np-nfine_current`/`np-nfine_gather` last particles
+                    //    deposit/gather in the buffer
+                    PartitionParticlesInBuffers( nfine_current, nfine_gather, np,
+                        pti, lev, current_masks, gather_masks );
+                }
 
-            if (rho && ! skip_deposition && ! do_not_deposit) {
-                // Deposit charge before particle push, in component 0 of MultiFab rho.
+                const long np_current = (cjx) ? nfine_current : np;
 
-                const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                    pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+                if (rho && ! skip_deposition && ! do_not_deposit) {
+                    // Deposit charge before particle push, in component 0 of MultiFab rho.
+                    const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
 
-                DepositCharge(pti, wp, ion_lev, rho, 0, 0,
-                              np_current, thread_num, lev, lev);
-                if (has_buffer){
-                    DepositCharge(pti, wp, ion_lev, crho, 0, np_current,
-                                  np-np_current, thread_num, lev, lev-1);
-                }
-            }
+                    const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+                        pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
 
-            if (! do_not_push)
-            {
-                const long np_gather = (cEx) ? nfine_gather : np;
-
-                int e_is_nodal = Ex.is_nodal() and Ey.is_nodal() and Ez.is_nodal();
-
-                //
-                // Gather and push for particles not in the buffer
-                //
-                WARPX_PROFILE_VAR_START(blp_fg);
-                const auto np_to_push = np_gather;
-                const auto gather_lev = lev;
-                if (push_type == PushType::Explicit) {
-                    PushPX(pti, exfab, eyfab, ezfab,
-                           bxfab, byfab, bzfab,
-                           Ex.nGrowVect(), e_is_nodal,
-                           0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
-                } else if (push_type == PushType::Implicit) {
-                    ImplicitPushXP(pti, exfab, eyfab, ezfab,
-                                   bxfab, byfab, bzfab,
-                                   Ex.nGrowVect(), e_is_nodal,
-                                   0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
+                    DepositCharge(pti, wp, ion_lev, rho, 0, 0,
+                                  np_current, thread_num, lev, lev);
+                    if (has_buffer){
+                        DepositCharge(pti, wp, ion_lev, crho, 0, np_current,
+                                      np-np_current, thread_num, lev, lev-1);
+                    }
                 }
 
-                if (np_gather < np)
+                if (! do_not_push)
                 {
-                    const IntVect& ref_ratio = WarpX::RefRatio(lev-1);
-                    const Box& cbox = amrex::coarsen(box,ref_ratio);
-
-                    // Data on the grid
-                    FArrayBox const* cexfab = &(*cEx)[pti];
-                    FArrayBox const* ceyfab = &(*cEy)[pti];
-                    FArrayBox const* cezfab = &(*cEz)[pti];
-                    FArrayBox const* cbxfab = &(*cBx)[pti];
-                    FArrayBox const* cbyfab = &(*cBy)[pti];
-                    FArrayBox const* cbzfab = &(*cBz)[pti];
-
-                    if (WarpX::use_fdtd_nci_corr)
-                    {
-                        // Filter arrays (*cEx)[pti], store the result in
-                        // filtered_Ex and update pointer cexfab so that it
-                        // points to filtered_Ex (and do the same for all
-                        // components of E and B)
-                        applyNCIFilter(lev-1, cbox, exeli, eyeli, ezeli, bxeli, byeli, bzeli,
-                                       filtered_Ex, filtered_Ey, filtered_Ez,
-                                       filtered_Bx, filtered_By, filtered_Bz,
-                                       (*cEx)[pti], (*cEy)[pti], (*cEz)[pti],
-                                       (*cBx)[pti], (*cBy)[pti], (*cBz)[pti],
-                                       cexfab, ceyfab, cezfab, cbxfab, cbyfab, cbzfab);
+                    np_pushed += np;
+
+                    const long np_gather = (cEx) ? nfine_gather : np;
+
+                    int e_is_nodal = Ex.is_nodal() and Ey.is_nodal() and Ez.is_nodal();
+
+                    //
+                    // Gather and push for particles not in the buffer
+                    //
+                    WARPX_PROFILE_VAR_START(blp_fg);
+                    const auto np_to_push = np_gather;
+                    const auto gather_lev = lev;
+
+                    // Optionally deposit the current in the push kernel,
+                    // when all the particles deposit on this level
+                    FusedCurrentDeposition fused_deposition;
+                    const bool do_fused_deposition = WarpX::do_fused_push_deposition &&
+                        push_type == PushType::Explicit && !has_buffer &&
+                        !skip_deposition && !do_not_deposit;
+                    if (do_fused_deposition) {
+                        fused_deposition.jx = &jx;
+                        fused_deposition.jy = &jy;
+                        fused_deposition.jz = &jz;
+                        fused_deposition.thread_num = thread_num;
                     }
 
-                    // Field gather and push for particles in gather buffers
-                    e_is_nodal = cEx->is_nodal() and cEy->is_nodal() and cEz->is_nodal();
                     if (push_type == PushType::Explicit) {
-                        PushPX(pti, cexfab, ceyfab, cezfab,
-                               cbxfab, cbyfab, cbzfab,
-                               cEx->nGrowVect(), e_is_nodal,
-                               nfine_gather, np-nfine_gather,
-                               lev, lev-1, dt, ScaleFields(false), a_dt_type);
+                        // The fused kernel cannot be split: its time, which includes
+                        // the gather and the push, is counted as deposition time
+                        std::optional<ablastr::utils::counters::ScopedTimer> fused_deposition_timer;
+                        if (do_fused_deposition) { fused_deposition_timer.emplace(deposition_time); }
+
+                        PushPX(pti, exfab, eyfab, ezfab,
+                               bxfab, byfab, bzfab,
+                               Ex.nGrowVect(), e_is_nodal,
+                               0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type,
+                               do_fused_deposition ? &fused_deposition : nullptr);
                     } else if (push_type == PushType::Implicit) {
-                        ImplicitPushXP(pti, cexfab, ceyfab, cezfab,
-                                       cbxfab, cbyfab, cbzfab,
-                                       cEx->nGrowVect(), e_is_nodal,
-                                       nfine_gather, np-nfine_gather,
-                                       lev, lev-1, dt, ScaleFields(false), a_dt_type);
+                        ImplicitPushXP(pti, exfab, eyfab, ezfab,
+                                       bxfab, byfab, bzfab,
+                                       Ex.nGrowVect(), e_is_nodal,
+                                       0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
                     }
-                }
 
-                WARPX_PROFILE_VAR_STOP(blp_fg);
-
-                // Current Deposition
-                if (!skip_deposition)
-                {
-                    // Deposit at t_{n+1/2} with explicit push
-                    const amrex::Real relative_time = (push_type == PushType::Explicit ? -0.5_rt * dt : 0.0_rt);
+                    if (np_gather < np)
+                    {
+                        const IntVect& ref_ratio = WarpX::RefRatio(lev-1);
+                        const Box& cbox = amrex::coarsen(box,ref_ratio);
+
+                        // Data on the grid
+                        FArrayBox const* cexfab = &(*cEx)[pti];
+                        FArrayBox const* ceyfab = &(*cEy)[pti];
+                        FArrayBox const* cezfab = &(*cEz)[pti];
+                        FArrayBox const* cbxfab = &(*cBx)[pti];
+                        FArrayBox const* cbyfab = &(*cBy)[pti];
+                        FArrayBox const* cbzfab = &(*cBz)[pti];
+
+                        if (WarpX::use_fdtd_nci_corr)
+                        {
+                            // Filter arrays (*cEx)[pti], store the result in
+                            // filtered_Ex and update pointer cexfab so that it
+                            // points to filtered_Ex (and do the same for all
+                            // components of E and B)
+                            applyNCIFilter(lev-1, cbox, exeli, eyeli, ezeli, bxeli, byeli, bzeli,
+                                           filtered_Ex, filtered_Ey, filtered_Ez,
+                                           filtered_Bx, filtered_By, filtered_Bz,
+                                           (*cEx)[pti], (*cEy)[pti], (*cEz)[pti],
+                                           (*cBx)[pti], (*cBy)[pti], (*cBz)[pti],
+                                           cexfab, ceyfab, cezfab, cbxfab, cbyfab, cbzfab);
+                        }
 
-                    const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                        pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+                        // Field gather and push for particles in gather buffers
+                        e_is_nodal = cEx->is_nodal() and cEy->is_nodal() and cEz->is_nodal();
+                        if (push_type == PushType::Explicit) {
+                            PushPX(pti, cexfab, ceyfab, cezfab,
+                                   cbxfab, cbyfab, cbzfab,
+                                   cEx->nGrowVect(), e_is_nodal,
+                                   nfine_gather, np-nfine_gather,
+                                   lev, lev-1, dt, ScaleFields(false), a_dt_type);
+                        } else if (push_type == PushType::Implicit) {
+                            ImplicitPushXP(pti, cexfab, ceyfab, cezfab,
+                                           cbxfab, cbyfab, cbzfab,
+                                           cEx->nGrowVect(), e_is_nodal,
+                                           nfine_gather, np-nfine_gather,
+                                           lev, lev-1, dt, ScaleFields(false), a_dt_type);
+                        }
+                    }
 
-                    // Deposit inside domains
-                    DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, &jx, &jy, &jz,
-                                   0, np_current, thread_num,
-                                   lev, lev, dt, relative_time, push_type);
+                    WARPX_PROFILE_VAR_STOP(blp_fg);
 
-                    if (has_buffer)
+                    // Current Deposition
+                    if (!skip_deposition && !fused_deposition.deposited)
                     {
-                        // Deposit in buffers
-                        DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, cjx, cjy, cjz,
-                                       np_current, np-np_current, thread_num,
-                                       lev, lev-1, dt, relative_time, push_type);
-                    }
-                } // end of "if electrostatic_solver_id == ElectrostaticSolverAlgo::None"
-            } // end of "if do_not_push"
+                        const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
 
-            if (rho && ! skip_deposition && ! do_not_deposit) {
-                // Deposit charge after particle push, in component 1 of MultiFab rho.
-                // (Skipped for electrostatic solver, as this may lead to out-of-bounds)
-                if (WarpX::electrostatic_solver_id == ElectrostaticSolverAlgo::None) {
-                    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(rho->nComp() >= 2,
-                        "Cannot deposit charge in rho component 1: only component 0 is allocated!");
+                        // Deposit at t_{n+1/2} with explicit push
+                        const amrex::Real relative_time = (push_type == PushType::Explicit ? -0.5_rt * dt : 0.0_rt);
 
-                    const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                        pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+                        const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+                            pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
 
-                    DepositCharge(pti, wp, ion_lev, rho, 1, 0,
-                                  np_current, thread_num, lev, lev);
-                    if (has_buffer){
-                        DepositCharge(pti, wp, ion_lev, crho, 1, np_current,
-                                      np-np_current, thread_num, lev, lev-1);
+                        // Deposit inside domains
+                        DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, &jx, &jy, &jz,
+                                       0, np_current, thread_num,
+                                       lev, lev, dt, relative_time, push_type);
+
+                        if (has_buffer)
+                        {
+                            // Deposit in buffers
+                            DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, cjx, cjy, cjz,
+                                           np_current, np-np_current, thread_num,
+                                           lev, lev-1, dt, relative_time, push_type);
+                        }
+                    } // end of "if electrostatic_solver_id == ElectrostaticSolverAlgo::None"
+                } // end of "if do_not_push"
+
+                if (rho && ! skip_deposition && ! do_not_deposit) {
+                    // Deposit charge after particle push, in component 1 of MultiFab rho.
+                    // (Skipped for electrostatic solver, as this may lead to out-of-bounds)
+                    if (WarpX::electrostatic_solver_id == ElectrostaticSolverAlgo::None) {
+                        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(rho->nComp() >= 2,
+                            "Cannot deposit charge in rho component 1: only component 0 is allocated!");
+
+                        const ablastr::utils::counters::ScopedTimer deposition_timer(deposition_time);
+
+                        const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+                            pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+
+                        DepositCharge(pti, wp, ion_lev, rho, 1, 0,
+                                      np_current, thread_num, lev, lev);
+                        if (has_buffer){
+                            DepositCharge(pti, wp, ion_lev, crho, 1, np_current,
+                                          np-np_current, thread_num, lev, lev-1);
+                        }
                     }
                 }
-            }
 
-            amrex::Gpu::synchronize();
+                amrex::Gpu::synchronize();
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
-            {
-                wt = static_cast<amrex::Real>(amrex::second()) - wt;
-                amrex::HostDevice::Atomic::Add( &(*cost)[pti.index()], wt);
+                if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
+                {
+                    wt = static_cast<amrex::Real>(amrex::second()) - wt;
+                    amrex::HostDevice::Atomic::Add( &(*cost)[pti.index()], wt);
+                }
+            }
+
+            if (ablastr::utils::counters::Enabled()) {
+                ablastr::utils::counters::Add("particles_pushed/" + species_name,
+                                              static_cast<double>(np_pushed));
+                ablastr::utils::counters::Add(DepositionCounterName(lev), deposition_time);
             }
         }
     }
+    m_deposit_in_place = false;
+
     // Split particles at the end of the timestep.
     // When subcycling is ON, the splitting is done on the last call to
     // PhysicalParticleContainer::Evolve on the finest level, i.e., at the
     // end of the large timestep. Otherwise, the pushes on different levels
     // are not consistent, and the call to Redistribute (inside
     // SplitParticles) may result in split particles to deposit twice on the
-    // coarse level.
-    if (do_splitting && (a_dt_type == DtType::SecondHalf || a_dt_type == DtType::Full) ){
+    // coarse level. When the tiles are processed in two passes, the splitting
+    // is done after the second pass.
+    if (do_splitting && (a_dt_type == DtType::SecondHalf || a_dt_type == DtType::Full) &&
+        m_deposition_tiles != DepositionTiles::Boundary) {
         SplitParticles(lev);
     }
 }
@@ -2463,13 +2539,19 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
                                    const long np_to_push,
                                    int lev, int gather_lev,
                                    amrex::Real dt, ScaleFields scaleFields,
-                                   DtType a_dt_type)
+                                   DtType a_dt_type,
+                                   FusedCurrentDeposition* fused_deposition)
 {
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE((gather_lev==(lev-1)) ||
                                      (gather_lev==(lev  )),
                                      "Gather buffers only work for lev-1");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!fused_deposition || gather_lev == lev,
+                                     "Fused current deposition only works without buffers");
     // If no particles, do not do anything
-    if (np_to_push == 0) { return; }
+    if (np_to_push == 0) {
+        if (fused_deposition) { fused_deposition->deposited = true; }
+        return;
+    }
 
     // Get cell size on gather_lev
     const amrex::XDim3 dinv = WarpX::InvCellSize(std::max(gather_lev,0));
@@ -2575,25 +2657,100 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
 
     const auto t_do_not_gather = do_not_gather;
 
-    enum exteb_flags : int { no_exteb, has_exteb };
-    enum qed_flags : int { no_qed, has_qed };
-
-    const int exteb_runtime_flag = getExternalEB.isNoOp() ? no_exteb : has_exteb;
+    // Current deposition fused with the push: the current is deposited at t_{n+1/2}
+    // from the new position and momentum, as done by DepositCurrent otherwise
+    const amrex::ParticleReal* AMREX_RESTRICT wp = attribs[PIdx::w].dataPtr() + offset;
+    const amrex::Real relative_time = -0.5_rt * dt;
+    const amrex::Real depos_invvol = dinv.x*dinv.y*dinv.z;
+    const amrex::XDim3 depos_invdtd = amrex::XDim3{(1.0_rt/dt)*dinv.y*dinv.z,
+                                                   (1.0_rt/dt)*dinv.x*dinv.z,
+                                                   (1.0_rt/dt)*dinv.x*dinv.y};
+    amrex::XDim3 depos_xyzmin = xyzmin;
+    amrex::Dim3 depos_lo = lo;
+    amrex::Array4<amrex::Real> jx_arr, jy_arr, jz_arr;
+    amrex::IntVect jx_type, jy_type, jz_type;
+#ifndef AMREX_USE_GPU
+    Box tbx, tby, tbz;
+#endif
 #ifdef WARPX_QED
-    const int qed_runtime_flag = (local_has_quantum_sync || do_sync) ? has_qed : no_qed;
+    const bool has_qed = local_has_quantum_sync || do_sync;
 #else
-    int qed_runtime_flag = no_qed;
+    const bool has_qed = false;
 #endif
 
+    // The current deposition is only fused with the push without external fields
+    // on the particles and without QED, otherwise it is done separately
+    const bool depos_esirkepov = (WarpX::current_deposition_algo == CurrentDepositionAlgo::Esirkepov);
+    int deposit = push_deposit_none;
+    if (fused_deposition && getExternalEB.isNoOp() && !has_qed && pushShapeOrderIsSpecialized(nox)) {
+        deposit = depos_esirkepov ? push_deposit_esirkepov : push_deposit_direct;
+    }
+
+    if (deposit != push_deposit_none) {
+        if (depos_esirkepov && WarpX::grid_type == GridType::Collocated) {
+            WARPX_ABORT_WITH_MESSAGE("Charge-conserving current depositions (Esirkepov and Villasenor) cannot be used with a collocated grid.");
+        }
+        const amrex::IntVect& ng_J = WarpX::GetInstance().get_ng_depos_J();
+        Box depos_box = pti.tilebox();
+#ifndef AMREX_USE_GPU
+        // CPU, tiling: deposit in the local_j<xyz>[thread_num] arrays
+        const int thread_num = fused_deposition->thread_num;
+        tbx = amrex::grow(amrex::convert(depos_box, fused_deposition->jx->ixType().toIntVect()), ng_J);
+        tby = amrex::grow(amrex::convert(depos_box, fused_deposition->jy->ixType().toIntVect()), ng_J);
+        tbz = amrex::grow(amrex::convert(depos_box, fused_deposition->jz->ixType().toIntVect()), ng_J);
+        if (m_deposit_in_place) {
+            // CPU, colored tiles: deposit directly in the j<xyz> arrays
+            jx_arr = fused_deposition->jx->array(pti);
+            jy_arr = fused_deposition->jy->array(pti);
+            jz_arr = fused_deposition->jz->array(pti);
+        } else {
+            local_jx[thread_num].resize(tbx, fused_deposition->jx->nComp());
+            local_jy[thread_num].resize(tby, fused_deposition->jy->nComp());
+            local_jz[thread_num].resize(tbz, fused_deposition->jz->nComp());
+            local_jx[thread_num].setVal(0.0);
+            local_jy[thread_num].setVal(0.0);
+            local_jz[thread_num].setVal(0.0);
+            jx_arr = local_jx[thread_num].array();
+            jy_arr = local_jy[thread_num].array();
+            jz_arr = local_jz[thread_num].array();
+        }
+        jx_type = tbx.type();
+        jy_type = tby.type();
+        jz_type = tbz.type();
+#else
+        // GPU, no tiling: deposit directly in the j<xyz> arrays
+        jx_arr = fused_deposition->jx->array(pti);
+        jy_arr = fused_deposition->jy->array(pti);
+        jz_arr = fused_deposition->jz->array(pti);
+        jx_type = (*fused_deposition->jx)[pti].box().type();
+        jy_type = (*fused_deposition->jy)[pti].box().type();
+        jz_type = (*fused_deposition->jz)[pti].box().type();
+#endif
+        depos_box.grow(ng_J);
+        depos_lo = lbound(depos_box);
+        // Take into account Galilean shift
+        depos_xyzmin = WarpX::LowerCorner(depos_box, lev, 0.5_rt*dt);
+    }
+
+    // Variant of the kernel: external fields, QED and fused current deposition, and,
+    // with the build option WarpX_PUSH_SPECIALIZE, shape order, layout of the fields and pusher
+    const bool collocated = (ex_type.nodeCentered() && ey_type.nodeCentered() && ez_type.nodeCentered() &&
+                             bx_type.nodeCentered() && by_type.nodeCentered() && bz_type.nodeCentered());
+    const int variant_runtime_flag = pushKernelVariantIndex(
+        !getExternalEB.isNoOp(), has_qed, deposit, WarpX::do_specialized_push,
+        nox, galerkin_interpolation, collocated, pusher_algo);
+
     // Using this version of ParallelFor with compile time options
-    // improves performance when qed or external EB are not used by reducing
-    // register pressure.
+    // improves performance when qed, external EB or fused deposition are not
+    // used by reducing register pressure.
     amrex::ParallelFor(
-        TypeList<CompileTimeOptions<no_exteb,has_exteb>, CompileTimeOptions<no_qed  ,has_qed>>{},
-        {exteb_runtime_flag, qed_runtime_flag},
+        TypeList<PushKernelOptions>{},
+        {variant_runtime_flag},
         np_to_push,
-        [=] AMREX_GPU_DEVICE (long ip, auto exteb_control, auto qed_control)
+        [=] AMREX_GPU_DEVICE (long ip, auto variant_control)
     {
+        constexpr PushKernelVariant variant = pushKernelVariant(decltype(variant_control)::value);
+
         amrex::ParticleReal xp, yp, zp;
         getPosition(ip, xp, yp, zp);
 
@@ -2616,7 +2773,8 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
 
         if(!t_do_not_gather){
             // first gather E and B to the particle positions
-            doGatherShapeN(xp, yp, zp, Exp, Eyp, Ezp, Bxp, Byp, Bzp,
+            doGatherShapeNCompileTime<variant.shape_order, variant.layout>(
+                           xp, yp, zp, Exp, Eyp, Ezp, Bxp, Byp, Bzp,
                            ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
                            ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
                            dinv, xyzmin, lo, n_rz_azimuthal_modes,
@@ -2624,7 +2782,7 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
         }
 
         [[maybe_unused]] const auto& getExternalEB_tmp = getExternalEB;
-        if constexpr (exteb_control == has_exteb) {
+        if constexpr (variant.exteb == 1) {
             getExternalEB(ip, Exp, Eyp, Ezp, Bxp, Byp, Bzp);
         }
 
@@ -2639,7 +2797,7 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
                 copyAttribs(ip);
             }
 
-            doParticleMomentumPush<0>(ux[ip], uy[ip], uz[ip],
+            doParticleMomentumPush<0, variant.pusher>(ux[ip], uy[ip], uz[ip],
                                       Exp, Eyp, Ezp, Bxp, Byp, Bzp,
                                       ion_lev ? ion_lev[ip] : 1,
                                       m, q, pusher_algo, do_crr,
@@ -2653,13 +2811,13 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
         }
 #ifdef WARPX_QED
         else {
-            if constexpr (qed_control == has_qed) {
+            if constexpr (variant.qed == 1) {
                 if (do_copy) {
                     //  Copy the old x and u for the BTD
                     copyAttribs(ip);
                 }
 
-                doParticleMomentumPush<1>(ux[ip], uy[ip], uz[ip],
+                doParticleMomentumPush<1, variant.pusher>(ux[ip], uy[ip], uz[ip],
                                           Exp, Eyp, Ezp, Bxp, Byp, Bzp,
                                           ion_lev ? ion_lev[ip] : 1,
                                           m, q, pusher_algo, do_crr,
@@ -2672,21 +2830,44 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
         }
 #endif
 
+        [[maybe_unused]] const auto& foo_jx_arr = jx_arr; // have to do this for nvcc
+        if constexpr (variant.deposit != push_deposit_none) {
+            // deposit the current with the new position and momentum
+            const amrex::Real wq = q*wp[ip]*(ion_lev ? ion_lev[ip] : 1);
+            doCurrentDepositionSingleParticle<variant.shape_order,
+                                              variant.deposit == push_deposit_esirkepov>(
+                                              xp, yp, zp, wq, ux[ip], uy[ip], uz[ip],
+                                              jx_arr, jy_arr, jz_arr, jx_type, jy_type, jz_type,
+                                              dt, relative_time, dinv, depos_xyzmin, depos_invdtd,
+                                              depos_invvol, depos_lo, n_rz_azimuthal_modes);
+        }
+
 #ifdef WARPX_QED
         [[maybe_unused]] auto foo_local_has_quantum_sync = local_has_quantum_sync;
         [[maybe_unused]] auto *foo_podq = p_optical_depth_QSR;
         [[maybe_unused]] const auto& foo_evolve_opt = evolve_opt; // have to do all these for nvcc
-        if constexpr (qed_control == has_qed) {
+        if constexpr (variant.qed == 1) {
             if (local_has_quantum_sync) {
                 evolve_opt(ux[ip], uy[ip], uz[ip],
                            Exp, Eyp, Ezp,Bxp, Byp, Bzp,
                            dt, p_optical_depth_QSR[ip]);
             }
         }
-#else
-            amrex::ignore_unused(qed_control);
 #endif
     });
+
+    if (deposit != push_deposit_none) {
+#ifndef AMREX_USE_GPU
+        // CPU, tiling: atomicAdd local_j<xyz> into j<xyz>
+        if (!m_deposit_in_place) {
+            const int thread_num = fused_deposition->thread_num;
+            (*fused_deposition->jx)[pti].lockAdd(local_jx[thread_num], tbx, tbx, 0, 0, fused_deposition->jx->nComp());
+            (*fused_deposition->jy)[pti].lockAdd(local_jy[thread_num], tby, tby, 0, 0, fused_deposition->jy->nComp());
+            (*fused_deposition->jz)[pti].lockAdd(local_jz[thread_num], tbz, tbz, 0, 0, fused_deposition->jz->nComp());
+        }
+#endif
+        fused_deposition->deposited = true;
+    }
 }
 
 /* \brief Perform the implicit particle push operation in one fused kernel
@@ -9,6 +9,7 @@
  */
 
 #include "Gather/FieldGather.H"
+#include "Particles/Deposition/DepositionTiles.H"
 #include "Particles/Gather/GetExternalFields.H"
 #include "Particles/PhysicalParticleContainer.H"
 #include "Particles/WarpXParticleContainer.H"
@@ -167,7 +168,8 @@ RigidInjectedParticleContainer::PushPX (WarpXParIter& pti,
                                         const long np_to_push,
                                         int lev, int gather_lev,
                                         amrex::Real dt, ScaleFields /*scaleFields*/,
-                                        DtType a_dt_type)
+                                        DtType a_dt_type,
+                                        FusedCurrentDeposition* /*fused_deposition*/)
 {
     auto& attribs = pti.GetAttribs();
     auto& uxp = attribs[PIdx::ux];
@@ -304,8 +306,11 @@ RigidInjectedParticleContainer::Evolve (int lev,
 {
 
     // Update location of injection plane in the boosted frame
-    zinject_plane_lev_previous = zinject_plane_levels[lev];
-    zinject_plane_levels[lev] -= dt*WarpX::beta_boost*PhysConst::c;
+    // (once per step, when the tiles are processed in two passes)
+    if (m_deposition_tiles != DepositionTiles::Interior) {
+        zinject_plane_lev_previous = zinject_plane_levels[lev];
+        zinject_plane_levels[lev] -= dt*WarpX::beta_boost*PhysConst::c;
+    }
     zinject_plane_lev = zinject_plane_levels[lev];
 
     // Set the done injecting flag when the inject plane moves out of the
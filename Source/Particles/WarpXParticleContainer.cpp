@@ -10,6 +10,7 @@
 #include "WarpXParticleContainer.H"
 
 #include "ablastr/particles/DepositCharge.H"
+#include "Deposition/BinnedCurrentDeposition.H"
 #include "Deposition/ChargeDeposition.H"
 #include "Deposition/CurrentDeposition.H"
 #include "Deposition/SharedDepositionUtils.H"
@@ -17,6 +18,7 @@
 #include "Pusher/GetAndSetPosition.H"
 #include "Pusher/UpdatePosition.H"
 #include "ParticleBoundaries_K.H"
+#include "Particles/MultiParticleContainer.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXConst.H"
@@ -26,6 +28,7 @@
 
 #include <ablastr/coarsen/average.H>
 #include <ablastr/utils/Communication.H>
+#include <ablastr/utils/counters/Counters.H>
 
 #include <AMReX.H>
 #include <AMReX_AmrCore.H>
@@ -72,6 +75,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <string>
 
 using namespace amrex;
 
@@ -119,6 +123,7 @@ WarpXParticleContainer::WarpXParticleContainer (AmrCore* amr_core, int ispecies)
     local_jx.resize(num_threads);
     local_jy.resize(num_threads);
     local_jz.resize(num_threads);
+    local_binned_deposition_buffer.resize(num_threads);
 
     // The boundary conditions are read in in ReadBCParams but a child class
     // can allow these value to be overwritten if different boundary
@@ -447,22 +452,28 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
     tby.grow(ng_J);
     tbz.grow(ng_J);
 
-    // CPU, tiling: j<xyz>_arr point to the local_j<xyz>[thread_num] arrays
-    local_jx[thread_num].resize(tbx, jx->nComp());
-    local_jy[thread_num].resize(tby, jy->nComp());
-    local_jz[thread_num].resize(tbz, jz->nComp());
-
-    // local_jx[thread_num] is set to zero
-    local_jx[thread_num].setVal(0.0);
-    local_jy[thread_num].setVal(0.0);
-    local_jz[thread_num].setVal(0.0);
-
-    auto & jx_fab = local_jx[thread_num];
-    auto & jy_fab = local_jy[thread_num];
-    auto & jz_fab = local_jz[thread_num];
-    Array4<Real> const& jx_arr = local_jx[thread_num].array();
-    Array4<Real> const& jy_arr = local_jy[thread_num].array();
-    Array4<Real> const& jz_arr = local_jz[thread_num].array();
+    // With colored tiles, deposit directly in the j<xyz> arrays
+    // (not in the buffers, whose tiles are coarsened and may overlap)
+    const bool deposit_in_place = m_deposit_in_place && (lev == depos_lev);
+
+    if (!deposit_in_place) {
+        // CPU, tiling: j<xyz>_arr point to the local_j<xyz>[thread_num] arrays
+        local_jx[thread_num].resize(tbx, jx->nComp());
+        local_jy[thread_num].resize(tby, jy->nComp());
+        local_jz[thread_num].resize(tbz, jz->nComp());
+
+        // local_jx[thread_num] is set to zero
+        local_jx[thread_num].setVal(0.0);
+        local_jy[thread_num].setVal(0.0);
+        local_jz[thread_num].setVal(0.0);
+    }
+
+    auto & jx_fab = deposit_in_place ? jx->get(pti) : local_jx[thread_num];
+    auto & jy_fab = deposit_in_place ? jy->get(pti) : local_jy[thread_num];
+    auto & jz_fab = deposit_in_place ? jz->get(pti) : local_jz[thread_num];
+    Array4<Real> const& jx_arr = jx_fab.array();
+    Array4<Real> const& jy_arr = jy_fab.array();
+    Array4<Real> const& jz_arr = jz_fab.array();
 #endif
 
     const auto GetPosition = GetParticlePosition<PIdx>(pti, offset);
@@ -576,6 +587,88 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
             WARPX_PROFILE_VAR_STOP(direct_current_dep_kernel);
         }
     }
+#ifndef AMREX_USE_GPU
+    // If doing binned deposition on CPU, deposit block by block
+    else if (WarpX::do_binned_current_deposition) {
+        const Geometry& geom = Geom(depos_lev);
+        const auto dxi = geom.InvCellSizeArray();
+        const auto plo = geom.ProbLoArray();
+        const auto domain = geom.Domain();
+
+        // tilebox already includes the guard cells ng_J
+        const Box box = tilebox;
+        const amrex::IntVect bin_size = WarpX::binned_deposition_blocksize;
+
+        //sort particles by block of cells
+        WARPX_PROFILE_VAR_START(blp_sort);
+        amrex::DenseBins<ParticleTileType::ParticleTileDataType> bins;
+        {
+            auto& ptile = ParticlesAt(lev, pti);
+            auto ptd = ptile.getParticleTileData();
+
+            const int nblocks = numTilesInBox(box, true, bin_size);
+
+            bins.build(ptile.numParticles(), ptd, nblocks,
+                    [=] AMREX_GPU_HOST_DEVICE (const ParticleType& p) -> unsigned int
+                    {
+                        Box tbox;
+                        auto iv = getParticleCell(p, plo, dxi, domain);
+                        // Particles outside of the tile (e.g. not in the range that
+                        // is deposited) are put in the closest block
+                        iv = amrex::elemwiseMax(amrex::elemwiseMin(iv, box.bigEnd()), box.smallEnd());
+                        auto tid = getTileIndex(iv, box, true, bin_size, tbox);
+                        return static_cast<unsigned int>(tid);
+                    });
+        }
+        WARPX_PROFILE_VAR_STOP(blp_sort);
+
+        BinnedDepositionParticles particles;
+        particles.GetPosition = GetPosition;
+        particles.wp = wp.dataPtr() + offset;
+        particles.uxp = uxp.dataPtr() + offset;
+        particles.uyp = uyp.dataPtr() + offset;
+        particles.uzp = uzp.dataPtr() + offset;
+        particles.ion_lev = ion_lev;
+        if (push_type == PushType::Implicit) {
+#if (AMREX_SPACEDIM >= 2)
+            particles.xp_n = pti.GetAttribs(particle_comps["x_n"]).dataPtr() + offset;
+#endif
+#if defined(WARPX_DIM_3D) || defined(WARPX_DIM_RZ)
+            particles.yp_n = pti.GetAttribs(particle_comps["y_n"]).dataPtr() + offset;
+#endif
+            particles.zp_n = pti.GetAttribs(particle_comps["z_n"]).dataPtr() + offset;
+            particles.uxp_n = pti.GetAttribs(particle_comps["ux_n"]).dataPtr() + offset;
+            particles.uyp_n = pti.GetAttribs(particle_comps["uy_n"]).dataPtr() + offset;
+            particles.uzp_n = pti.GetAttribs(particle_comps["uz_n"]).dataPtr() + offset;
+        }
+
+        if        (WarpX::nox == 1){
+            doBinnedCurrentDepositionShapeN<1>(
+                particles, bins, jx_fab, jy_fab, jz_fab, offset, np_to_deposit, ng_J,
+                dt, relative_time, dinv, xyzmin, lo, q, WarpX::n_rz_azimuthal_modes,
+                WarpX::current_deposition_algo, push_type,
+                local_binned_deposition_buffer[thread_num]);
+        } else if (WarpX::nox == 2){
+            doBinnedCurrentDepositionShapeN<2>(
+                particles, bins, jx_fab, jy_fab, jz_fab, offset, np_to_deposit, ng_J,
+                dt, relative_time, dinv, xyzmin, lo, q, WarpX::n_rz_azimuthal_modes,
+                WarpX::current_deposition_algo, push_type,
+                local_binned_deposition_buffer[thread_num]);
+        } else if (WarpX::nox == 3){
+            doBinnedCurrentDepositionShapeN<3>(
+                particles, bins, jx_fab, jy_fab, jz_fab, offset, np_to_deposit, ng_J,
+                dt, relative_time, dinv, xyzmin, lo, q, WarpX::n_rz_azimuthal_modes,
+                WarpX::current_deposition_algo, push_type,
+                local_binned_deposition_buffer[thread_num]);
+        } else if (WarpX::nox == 4){
+            doBinnedCurrentDepositionShapeN<4>(
+                particles, bins, jx_fab, jy_fab, jz_fab, offset, np_to_deposit, ng_J,
+                dt, relative_time, dinv, xyzmin, lo, q, WarpX::n_rz_azimuthal_modes,
+                WarpX::current_deposition_algo, push_type,
+                local_binned_deposition_buffer[thread_num]);
+        }
+    }
+#endif
     // If not doing shared memory deposition, call normal kernels
     else {
         if (WarpX::current_deposition_algo == CurrentDepositionAlgo::Esirkepov) {
@@ -813,11 +906,13 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
 
 #ifndef AMREX_USE_GPU
     // CPU, tiling: atomicAdd local_j<xyz> into j<xyz>
-    WARPX_PROFILE_VAR_START(blp_accumulate);
-    (*jx)[pti].lockAdd(local_jx[thread_num], tbx, tbx, 0, 0, jx->nComp());
-    (*jy)[pti].lockAdd(local_jy[thread_num], tby, tby, 0, 0, jy->nComp());
-    (*jz)[pti].lockAdd(local_jz[thread_num], tbz, tbz, 0, 0, jz->nComp());
-    WARPX_PROFILE_VAR_STOP(blp_accumulate);
+    if (!deposit_in_place) {
+        WARPX_PROFILE_VAR_START(blp_accumulate);
+        (*jx)[pti].lockAdd(local_jx[thread_num], tbx, tbx, 0, 0, jx->nComp());
+        (*jy)[pti].lockAdd(local_jy[thread_num], tby, tby, 0, 0, jy->nComp());
+        (*jz)[pti].lockAdd(local_jz[thread_num], tbz, tbz, 0, 0, jz->nComp());
+        WARPX_PROFILE_VAR_STOP(blp_accumulate);
+    }
 #endif
 }
 
@@ -830,6 +925,8 @@ WarpXParticleContainer::DepositCurrent (
     auto const finest_level = static_cast<int>(J.size() - 1);
     for (int lev = 0; lev <= finest_level; ++lev)
     {
+        const ablastr::utils::counters::ScopedTimer deposition_timer(DepositionCounterName(lev));
+
         // Loop over particle tiles and deposit current on each level
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -1165,7 +1262,7 @@ WarpXParticleContainer::DepositCharge (WarpXParIter& pti, RealVector const& wp,
                 WarpX::noz, dinv, xyzmin, WarpX::n_rz_azimuthal_modes,
                 ng_rho, depos_lev, ref_ratio,
                 offset, np_to_deposit,
-                icomp, nc);
+                icomp, nc, m_deposit_in_place && (lev == depos_lev));
     }
 }
 
@@ -1226,6 +1323,9 @@ WarpXParticleContainer::DepositCharge (std::unique_ptr<amrex::MultiFab>& rho,
     int const nc = WarpX::ncomps;
     if (reset) { rho->setVal(0., icomp*nc, nc, rho->nGrowVect()); }
 
+    {
+    const ablastr::utils::counters::ScopedTimer deposition_timer(DepositionCounterName(lev));
+
     // Loop over particle tiles and deposit charge on each level
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -1250,6 +1350,7 @@ WarpXParticleContainer::DepositCharge (std::unique_ptr<amrex::MultiFab>& rho,
 #ifdef AMREX_USE_OMP
     }
 #endif
+    }
 
 #ifdef WARPX_DIM_RZ
     if (apply_boundary_and_scale_volume)
@@ -1304,6 +1405,16 @@ WarpXParticleContainer::GetChargeDensity (int lev, bool local)
     return rho;
 }
 
+std::string
+WarpXParticleContainer::DepositionCounterName (const int lev) const
+{
+    if (!ablastr::utils::counters::Enabled()) { return {}; }
+    const auto names = WarpX::GetInstance().GetPartContainer().GetSpeciesAndLasersNames();
+    const std::string species_name = (species_id >= 0 && species_id < static_cast<int>(names.size())) ?
+        names[species_id] : "species" + std::to_string(species_id);
+    return "deposition_time/" + species_name + "/lev" + std::to_string(lev);
+}
+
 amrex::ParticleReal WarpXParticleContainer::sumParticleWeight(bool local) {
 
     amrex::ParticleReal total_weight = 0.0;
@@ -1481,7 +1592,7 @@ WarpXParticleContainer::PushX (int lev, amrex::Real dt)
 
         for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
         {
-            if (costs && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (costs && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
             }
@@ -1510,7 +1621,7 @@ WarpXParticleContainer::PushX (int lev, amrex::Real dt)
                 }
             );
 
-            if (costs && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (costs && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
             {
                 amrex::Gpu::synchronize();
                 wt = static_cast<amrex::Real>(amrex::second()) - wt;
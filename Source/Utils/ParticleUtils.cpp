@@ -41,6 +41,17 @@ namespace ParticleUtils
                              MFIter const & mfi,
                              ParticleTileType & ptile) {
 
+        ParticleBins bins;
+        findParticlesInEachCell(bins, lev, mfi, ptile);
+        return bins;
+    }
+
+    void
+    findParticlesInEachCell (ParticleBins & bins,
+                             int lev,
+                             MFIter const & mfi,
+                             ParticleTileType & ptile) {
+
         // Extract particle structures for this tile
         int const np = ptile.numParticles();
         auto ptd = ptile.getParticleTileData();
@@ -54,7 +65,6 @@ namespace ParticleUtils
 
         // Find particles that are in each cell;
         // results are stored in the object `bins`.
-        ParticleBins bins;
         bins.build(np, ptd, cbx,
             // Pass lambda function that returns the cell index
             [=] AMREX_GPU_DEVICE (ParticleType const & p) noexcept -> amrex::IntVect
@@ -64,8 +74,6 @@ namespace ParticleUtils
                                    static_cast<int>((p.pos(1)-plo[1])*dxi[1] - lo.y),
                                    static_cast<int>((p.pos(2)-plo[2])*dxi[2] - lo.z))};
             });
-
-        return bins;
     }
 
 } // namespace ParticleUtils
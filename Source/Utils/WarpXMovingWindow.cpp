@@ -12,6 +12,7 @@
 #if (defined WARPX_DIM_RZ) && (defined WARPX_USE_FFT)
 #   include "BoundaryConditions/PML_RZ.H"
 #endif
+#include "FieldSolver/ElectrostaticSolvers/ElectrostaticSolver.H"
 #include "Initialization/ExternalField.H"
 #include "Particles/MultiParticleContainer.H"
 #include "Fluids/MultiFluidContainer.H"
@@ -482,12 +483,12 @@ WarpX::shiftMF (amrex::MultiFab& mf, const amrex::Geometry& geom,
 
     AMREX_ALWAYS_ASSERT(ng[dir] >= num_shift);
 
-    amrex::MultiFab tmpmf(ba, dm, nc, ng);
-    amrex::MultiFab::Copy(tmpmf, mf, 0, 0, nc, ng);
-
+    // The data is shifted in place: the guard cells of mf are filled with the data
+    // that enters the valid region of each box, and each box is then shifted in place,
+    // which avoids allocating and copying a temporary MultiFab.
     if ( WarpX::safe_guard_cells ) {
         // Fill guard cells.
-        ablastr::utils::communication::FillBoundary(tmpmf, WarpX::do_single_precision_comms, geom.periodicity());
+        ablastr::utils::communication::FillBoundary(mf, WarpX::do_single_precision_comms, geom.periodicity());
     } else {
         amrex::IntVect ng_mw = amrex::IntVect::TheUnitVector();
         // Enough guard cells in the MW direction
@@ -495,7 +496,7 @@ WarpX::shiftMF (amrex::MultiFab& mf, const amrex::Geometry& geom,
         // Make sure we don't exceed number of guard cells allocated
         ng_mw = ng_mw.min(ng);
         // Fill guard cells.
-        ablastr::utils::communication::FillBoundary(tmpmf, ng_mw, WarpX::do_single_precision_comms, geom.periodicity());
+        ablastr::utils::communication::FillBoundary(mf, ng_mw, WarpX::do_single_precision_comms, geom.periodicity());
     }
 
     // Make a box that covers the region that the window moved into
@@ -530,32 +531,32 @@ WarpX::shiftMF (amrex::MultiFab& mf, const amrex::Geometry& geom,
     const auto dx = geom.CellSizeArray();
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
+    // No tiling: each box is shifted in place as a whole
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
 
-    for (amrex::MFIter mfi(tmpmf, TilingIfNotGPU()); mfi.isValid(); ++mfi )
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi )
     {
-        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        if (cost && WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
         }
         auto wt = static_cast<amrex::Real>(amrex::second());
 
-        auto const& dstfab = mf.array(mfi);
-        auto const& srcfab = tmpmf.array(mfi);
+        auto const& fab = mf.array(mfi);
 
-        const amrex::Box& outbox = mfi.growntilebox() & adjBox;
+        const amrex::Box& outbox = mfi.fabbox() & adjBox;
 
         if (outbox.ok()) {
             if (!useparser) {
                 AMREX_PARALLEL_FOR_4D ( outbox, nc, i, j, k, n,
                 {
-                    srcfab(i,j,k,n) = external_field;
+                    fab(i,j,k,n) = external_field;
                 })
             } else {
-                // index type of the src mf
-                auto const& mf_IndexType = (tmpmf).ixType();
+                // index type of the mf
+                auto const& mf_IndexType = mf.ixType();
                 amrex::IntVect mf_type(AMREX_D_DECL(0,0,0));
                 for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                     mf_type[idim] = mf_IndexType.nodeCentered(idim);
@@ -584,7 +585,7 @@ WarpX::shiftMF (amrex::MultiFab& mf, const amrex::Geometry& geom,
                       const amrex::Real fac_z = (1.0_rt - mf_type[2]) * dx[2]*0.5_rt;
                       const amrex::Real z = k*dx[2] + real_box.lo(2) + fac_z;
 #endif
-                      srcfab(i,j,k,n) = field_parser(x,y,z);
+                      fab(i,j,k,n) = field_parser(x,y,z);
                 });
             }
 
@@ -596,13 +597,32 @@ WarpX::shiftMF (amrex::MultiFab& mf, const amrex::Geometry& geom,
         } else {
             dstBox.growLo(dir,  num_shift);
         }
-        AMREX_PARALLEL_FOR_4D ( dstBox, nc, i, j, k, n,
+        // Each thread shifts a line of cells along dir, starting from the side the data
+        // moves towards: a cell is read before being overwritten.
+        const int nlines = dstBox.length(dir);
+        const int step = (num_shift > 0) ? 1 : -1;
+        amrex::IntVect stepiv(0);
+        stepiv[dir] = step;
+        const amrex::Dim3 line_step = stepiv.dim3();
+        amrex::Box lineBox = dstBox;
+        if (num_shift > 0) {
+            lineBox.setBig(dir, dstBox.smallEnd(dir));
+        } else {
+            lineBox.setSmall(dir, dstBox.bigEnd(dir));
+        }
+        AMREX_PARALLEL_FOR_4D ( lineBox, nc, i, j, k, n,
         {
-            dstfab(i,j,k,n) = srcfab(i+shift.x,j+shift.y,k+shift.z,n);
+            int ii = i, jj = j, kk = k;
+            for (int l = 0; l < nlines; ++l) {
+                fab(ii,jj,kk,n) = fab(ii+shift.x,jj+shift.y,kk+shift.z,n);
+                ii += line_step.x;
+                jj += line_step.y;
+                kk += line_step.z;
+            }
         })
 
         if (cost && update_cost_flag &&
-            WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic)
         {
             amrex::Gpu::synchronize();
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -699,4 +719,8 @@ WarpX::ResetProbDomain (const amrex::RealBox& rb)
         g.ProbDomain(rb);
         SetGeometry(lev, g);
     }
+
+    // The MLMG operators of the electrostatic solver and the history of phi
+    // refer to the previous problem domain
+    if (m_electrostatic_solver) { m_electrostatic_solver->ResetSolverCache(); }
 }
@@ -34,9 +34,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <iterator>
+#include <iomanip>
 #include <set>
+#include <sstream>
 #include <string>
 #include <limits>
 
@@ -274,6 +278,20 @@ namespace WarpXUtilIO{
         of.close();
         return  of.good();
     }
+
+    std::string HashBinaryData(const std::vector<char>& data)
+    {
+        constexpr auto fnv_offset_basis = std::uint64_t{14695981039346656037ULL};
+        constexpr auto fnv_prime = std::uint64_t{1099511628211ULL};
+        auto hash = fnv_offset_basis;
+        for (const auto c : data) {
+            hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+            hash *= fnv_prime;
+        }
+        std::ostringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return ss.str();
+    }
 }
 
 void CheckDims ()
@@ -490,7 +508,76 @@ namespace WarpXUtilLoadBalance
     {
         const bool consistent = cost && (dm == cost->DistributionMap()) &&
             (ba.CellEqual(cost->boxArray())) &&
-            (WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers);
+            (WarpX::load_balance_costs_update_algo != LoadBalanceCostsUpdateAlgo::Heuristic);
         return consistent;
     }
+
+    amrex::Vector<int> MakeIncrementalProcessorMap (
+        amrex::Vector<int> const& pmap,
+        std::vector<amrex::Real> const& costs,
+        std::vector<amrex::Long> const& bytes,
+        int nprocs, int max_moved_boxes, amrex::Long max_moved_bytes,
+        amrex::Real& currentEfficiency, amrex::Real& proposedEfficiency)
+    {
+        const int nboxes = static_cast<int>(pmap.size());
+        amrex::Vector<int> new_pmap = pmap;
+
+        std::vector<double> loads(nprocs, 0.);
+        std::vector<std::vector<int>> boxes_of_proc(nprocs);
+        for (int ib = 0; ib < nboxes; ++ib) {
+            loads[pmap[ib]] += costs[ib];
+            boxes_of_proc[pmap[ib]].push_back(ib);
+        }
+        auto efficiency = [&loads] () {
+            double total = 0., max_load = 0.;
+            for (auto const load : loads) {
+                total += load;
+                max_load = std::max(max_load, load);
+            }
+            return (max_load > 0.) ? static_cast<amrex::Real>(total/(max_load*loads.size())) : amrex::Real(1.0);
+        };
+        currentEfficiency = efficiency();
+
+        // a box is moved at most once, so that its data is sent at most once
+        std::vector<bool> moved(nboxes, false);
+        int nmoved_boxes = 0;
+        amrex::Long nmoved_bytes = 0;
+        while (max_moved_boxes < 0 || nmoved_boxes < max_moved_boxes)
+        {
+            const auto p = static_cast<int>(std::distance(loads.begin(),
+                std::max_element(loads.begin(), loads.end())));
+            const auto q = static_cast<int>(std::distance(loads.begin(),
+                std::min_element(loads.begin(), loads.end())));
+            if (p == q) { break; }
+
+            int best_box = -1;
+            double best_score = 0.;
+            for (auto const ib : boxes_of_proc[p])
+            {
+                if (moved[ib] || costs[ib] <= amrex::Real(0.0)) { continue; }
+                if (max_moved_bytes >= 0 && nmoved_bytes + bytes[ib] > max_moved_bytes) { continue; }
+                // reduction of the load of the most loaded of p and q
+                const double gain = loads[p] - std::max(loads[p] - costs[ib], loads[q] + costs[ib]);
+                const double score = gain / static_cast<double>(std::max(bytes[ib], amrex::Long(1)));
+                if (gain > 0. && score > best_score) {
+                    best_box = ib;
+                    best_score = score;
+                }
+            }
+            if (best_box < 0) { break; }
+
+            loads[p] -= costs[best_box];
+            loads[q] += costs[best_box];
+            auto& boxes_p = boxes_of_proc[p];
+            boxes_p.erase(std::find(boxes_p.begin(), boxes_p.end(), best_box));
+            boxes_of_proc[q].push_back(best_box);
+            new_pmap[best_box] = q;
+            moved[best_box] = true;
+            ++nmoved_boxes;
+            nmoved_bytes += bytes[best_box];
+        }
+
+        proposedEfficiency = efficiency();
+        return new_pmap;
+    }
 }
@@ -38,6 +38,7 @@
 #include "Fluids/MultiFluidContainer.H"
 #include "Fluids/WarpXFluidContainer.H"
 #include "Particles/ParticleBoundaryBuffer.H"
+#include "Particles/Pusher/PushCompileTimeOptions.H"
 #include "AcceleratorLattice/AcceleratorLattice.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
@@ -101,6 +102,7 @@ int WarpX::moving_window_dir = -1;
 Real WarpX::moving_window_v = std::numeric_limits<amrex::Real>::max();
 
 bool WarpX::fft_do_time_averaging = false;
+bool WarpX::fft_batch_vector_fields = true;
 
 amrex::IntVect WarpX::m_fill_guards_fields  = amrex::IntVect(0);
 amrex::IntVect WarpX::m_fill_guards_current = amrex::IntVect(0);
@@ -132,6 +134,20 @@ amrex::IntVect WarpX::shared_tilesize(AMREX_D_DECL(1,1,1));
 #endif
 int WarpX::shared_mem_current_tpb = 128;
 
+bool WarpX::do_binned_current_deposition = false;
+#if defined(WARPX_DIM_3D)
+amrex::IntVect WarpX::binned_deposition_blocksize(AMREX_D_DECL(4,4,4));
+#elif (AMREX_SPACEDIM == 2)
+amrex::IntVect WarpX::binned_deposition_blocksize(AMREX_D_DECL(8,8,0));
+#else
+amrex::IntVect WarpX::binned_deposition_blocksize(AMREX_D_DECL(16,1,1));
+#endif
+
+bool WarpX::do_specialized_push = true;
+bool WarpX::do_fused_push_deposition = false;
+bool WarpX::do_colored_tile_deposition = false;
+bool WarpX::do_overlap_current_sum = false;
+
 int WarpX::n_rz_azimuthal_modes = 1;
 int WarpX::ncomps = 1;
 
@@ -857,6 +873,40 @@ WarpX::ReadParameters ()
             }
         }
 
+        pp_warpx.query("do_binned_current_deposition", do_binned_current_deposition);
+#ifdef AMREX_USE_GPU
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!do_binned_current_deposition,
+                "requested binned current deposition, but it is only available for CPU builds");
+#endif
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!(do_binned_current_deposition && do_shared_mem_current_deposition),
+                "warpx.do_binned_current_deposition and warpx.do_shared_mem_current_deposition cannot be used together");
+
+        // initialize the size of the blocks for binned deposition
+        Vector<int> vect_binned_deposition_blocksize(AMREX_SPACEDIM, 1);
+        const bool binned_deposition_blocksize_is_specified = utils::parser::queryArrWithParser(pp_warpx, "binned_deposition_blocksize",
+                                                            vect_binned_deposition_blocksize, 0, AMREX_SPACEDIM);
+        if (binned_deposition_blocksize_is_specified){
+            for (int i=0; i<AMREX_SPACEDIM; i++) {
+                binned_deposition_blocksize[i] = vect_binned_deposition_blocksize[i];
+            }
+        }
+
+        pp_warpx.query("do_specialized_push", do_specialized_push);
+
+        pp_warpx.query("do_fused_push_deposition", do_fused_push_deposition);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            !do_fused_push_deposition ||
+            (!do_shared_mem_current_deposition && !do_binned_current_deposition),
+            "warpx.do_fused_push_deposition cannot be used with shared memory or binned current deposition");
+
+        pp_warpx.query("do_colored_tile_deposition", do_colored_tile_deposition);
+#ifdef AMREX_USE_GPU
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!do_colored_tile_deposition,
+                "requested colored tile deposition, but it is only available for CPU builds");
+#endif
+
+        pp_warpx.query("do_overlap_current_sum", do_overlap_current_sum);
+
         pp_warpx.query("serialize_initial_conditions", serialize_initial_conditions);
         pp_warpx.query("refine_plasma", refine_plasma);
         pp_warpx.query("do_dive_cleaning", do_dive_cleaning);
@@ -1235,6 +1285,33 @@ WarpX::ReadParameters ()
                 "Vay deposition not implemented with multi-J algorithm");
         }
 
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            WarpX::current_deposition_algo != CurrentDepositionAlgo::Vay ||
+            !do_binned_current_deposition,
+            "Vay deposition not implemented with binned current deposition");
+
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            !do_fused_push_deposition ||
+            WarpX::current_deposition_algo == CurrentDepositionAlgo::Direct ||
+            WarpX::current_deposition_algo == CurrentDepositionAlgo::Esirkepov,
+            "warpx.do_fused_push_deposition is only implemented for the direct and Esirkepov current depositions");
+
+        if (do_overlap_current_sum) {
+#ifdef WARPX_DIM_RZ
+            WARPX_ABORT_WITH_MESSAGE("warpx.do_overlap_current_sum is not implemented in RZ geometry");
+#endif
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                evolve_scheme == EvolveScheme::Explicit &&
+                (electromagnetic_solver_id == ElectromagneticSolverAlgo::Yee ||
+                 electromagnetic_solver_id == ElectromagneticSolverAlgo::CKC ||
+                 electromagnetic_solver_id == ElectromagneticSolverAlgo::ECT),
+                "warpx.do_overlap_current_sum is only implemented for the explicit FDTD solvers");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(maxLevel() == 0 && !do_current_centering,
+                "warpx.do_overlap_current_sum cannot be used with mesh refinement or current centering");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!do_single_precision_comms,
+                "warpx.do_overlap_current_sum cannot be used with single precision communications");
+        }
+
         if (current_deposition_algo == CurrentDepositionAlgo::Villasenor) {
             WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
                 evolve_scheme == EvolveScheme::SemiImplicitEM ||
@@ -1344,6 +1421,15 @@ WarpX::ReadParameters ()
         }
         utils::parser::queryWithParser(pp_algo, "load_balance_efficiency_ratio_threshold",
                         load_balance_efficiency_ratio_threshold);
+        utils::parser::queryWithParser(pp_algo, "load_balance_max_moved_boxes",
+                        load_balance_max_moved_boxes);
+        amrex::Real max_moved_bytes = -1.0_rt;
+        utils::parser::queryWithParser(pp_algo, "load_balance_max_moved_bytes", max_moved_bytes);
+        load_balance_max_moved_bytes = static_cast<amrex::Long>(max_moved_bytes);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            load_balance_max_moved_boxes != 0 && load_balance_max_moved_bytes != 0,
+            "algo.load_balance_max_moved_boxes and algo.load_balance_max_moved_bytes must be positive "
+            "(or negative for no limit)");
         pp_algo.query_enum_sloppy("load_balance_costs_update", load_balance_costs_update_algo, "-_");
         if (WarpX::load_balance_costs_update_algo==LoadBalanceCostsUpdateAlgo::Heuristic) {
             utils::parser::queryWithParser(
@@ -1387,6 +1473,11 @@ WarpX::ReadParameters ()
                 nox = particle_shape;
                 noy = particle_shape;
                 noz = particle_shape;
+
+                WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                    !do_fused_push_deposition || pushShapeOrderIsSpecialized(particle_shape),
+                    "warpx.do_fused_push_deposition requires WarpX to be built with "
+                    "WarpX_PUSH_SPECIALIZE set to ALL or to algo.particle_shape");
             }
             else{
                 WARPX_ABORT_WITH_MESSAGE(
@@ -1563,6 +1654,7 @@ WarpX::ReadParameters ()
         }
 
         pp_psatd.query("do_time_averaging", fft_do_time_averaging);
+        pp_psatd.query("batch_fft", fft_batch_vector_fields);
 
         if (WarpX::current_deposition_algo == CurrentDepositionAlgo::Vay)
         {
@@ -10,6 +10,7 @@
 #include <ablastr/warn_manager/WarnManager.H>
 #include <ablastr/math/fft/AnyFFT.H>
 
+#include <AMReX.H>
 #include <AMReX_Array4.H>
 #include <AMReX_BaseFab.H>
 #include <AMReX_BLassert.H>
@@ -25,18 +26,439 @@
 #include <AMReX_MFIter.H>
 #include <AMReX_MLLinOp.H>
 #include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
 #include <AMReX_REAL.H>
+#include <AMReX_Vector.H>
 
+#include <algorithm>
 #include <array>
+#include <memory>
 
 
+namespace
+{
+    using SpectralField = amrex::FabArray< amrex::BaseFab< amrex::GpuComplex< amrex::Real > > >;
+
+    /** @brief Fill the integrated Green function on the doubled domain
+     *
+     * The values in the first octant are mirrored to the other octants, so that
+     * the convolution by FFTs is not periodic; the mid-points are zero.
+     *
+     * @param[out] tmp_G the Green function, on (part of) realspace_box
+     * @param[in] realspace_box the doubled domain
+     * @param[in] n the size of the domain, along each dimension
+     * @param[in] cell_size an array of 3 reals dx dy dz
+     */
+    void
+    fillIntegratedGreenFunction (amrex::MultiFab & tmp_G,
+                                 amrex::Box const & realspace_box,
+                                 amrex::IntVect const & n,
+                                 std::array<amrex::Real, 3> const & cell_size)
+    {
+        using namespace amrex::literals;
+
+        BL_PROFILE("Initialize Green function");
+
+        amrex::IntVect const lo = realspace_box.smallEnd();
+        amrex::Real const dx = cell_size[0];
+        amrex::Real const dy = cell_size[1];
+        amrex::Real const dz = cell_size[2];
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(tmp_G, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+            amrex::Box const bx = mfi.tilebox();
+            amrex::Array4<amrex::Real> const tmp_G_arr = tmp_G.array(mfi);
+
+            amrex::ParallelFor( bx,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+                {
+                    int i0 = i - lo[0];
+                    int j0 = j - lo[1];
+                    int k0 = k - lo[2];
+                    if (i0 == n[0] || j0 == n[1] || k0 == n[2]) {
+                        tmp_G_arr(i,j,k) = 0._rt;
+                        return;
+                    }
+                    // Fill the rest of the array by periodicity
+                    if (i0 > n[0]) { i0 = 2*n[0] - i0; }
+                    if (j0 > n[1]) { j0 = 2*n[1] - j0; }
+                    if (k0 > n[2]) { k0 = 2*n[2] - k0; }
+                    amrex::Real const x = i0*dx;
+                    amrex::Real const y = j0*dy;
+                    amrex::Real const z = k0*dz;
+
+                    tmp_G_arr(i,j,k) = 1._rt/(4._rt*ablastr::constant::math::pi*ablastr::constant::SI::ep0) * (
+                        ablastr::fields::IntegratedPotential( x+0.5_rt*dx, y+0.5_rt*dy, z+0.5_rt*dz )
+                      - ablastr::fields::IntegratedPotential( x-0.5_rt*dx, y+0.5_rt*dy, z+0.5_rt*dz )
+                      - ablastr::fields::IntegratedPotential( x+0.5_rt*dx, y-0.5_rt*dy, z+0.5_rt*dz )
+                      - ablastr::fields::IntegratedPotential( x+0.5_rt*dx, y+0.5_rt*dy, z-0.5_rt*dz )
+                      + ablastr::fields::IntegratedPotential( x+0.5_rt*dx, y-0.5_rt*dy, z-0.5_rt*dz )
+                      + ablastr::fields::IntegratedPotential( x-0.5_rt*dx, y+0.5_rt*dy, z-0.5_rt*dz )
+                      + ablastr::fields::IntegratedPotential( x-0.5_rt*dx, y-0.5_rt*dy, z+0.5_rt*dz )
+                      - ablastr::fields::IntegratedPotential( x-0.5_rt*dx, y-0.5_rt*dy, z-0.5_rt*dz )
+                    );
+                }
+            );
+        }
+    }
+
+    /** Start of the part ipart of [0,n), when split in nparts nearly equal parts */
+    int
+    splitStart (int n, int nparts, int ipart)
+    {
+        return static_cast<int>( (static_cast<long>(n) * ipart) / nparts );
+    }
+
+    /** Real-to-complex 3D FFT of the doubled domain, used for the convolution with the Green function */
+    class ConvolutionFFT
+    {
+    public:
+        ConvolutionFFT () = default;
+        virtual ~ConvolutionFFT () = default;
+
+        ConvolutionFFT (ConvolutionFFT const &) = delete;
+        ConvolutionFFT& operator= (ConvolutionFFT const &) = delete;
+        ConvolutionFFT (ConvolutionFFT &&) = delete;
+        ConvolutionFFT& operator= (ConvolutionFFT &&) = delete;
+
+        /** Real-space data */
+        virtual amrex::MultiFab& real () = 0;
+
+        /** Spectral-space data */
+        virtual SpectralField& spectral () = 0;
+
+        /** FFT from real() to spectral() */
+        virtual void forward () = 0;
+
+        /** Inverse FFT from spectral() to real() (not normalized) */
+        virtual void backward () = 0;
+    };
+
+    /** @brief Real-to-complex 3D FFT of the doubled domain, on a single MPI rank */
+    class GlobalFFT final : public ConvolutionFFT
+    {
+    public:
+        /** @param[in] realspace_box the doubled domain */
+        explicit GlobalFFT (amrex::Box const & realspace_box)
+        {
+            namespace anyfft = ablastr::math::anyfft;
+
+            amrex::IntVect const n = realspace_box.length();
+
+            // The box arrays for the global FFT contain only one box
+            amrex::BoxArray const realspace_ba = amrex::BoxArray( realspace_box );
+            amrex::Box const spectralspace_box = amrex::Box(
+                {0,0,0},
+                {n[0]/2, n[1]-1, n[2]-1},
+                amrex::IntVect::TheNodeVector() );
+            amrex::BoxArray const spectralspace_ba = amrex::BoxArray( spectralspace_box );
+            // Define a distribution mapping for the global FFT, with only one box
+            amrex::DistributionMapping dm_global_fft;
+            dm_global_fft.define( realspace_ba );
+
+            m_real.define(realspace_ba, dm_global_fft, 1, 0);
+            m_spectral.define(spectralspace_ba, dm_global_fft, 1, 0);
+
+            m_forward_plan.define(spectralspace_ba, dm_global_fft);
+            m_backward_plan.define(spectralspace_ba, dm_global_fft);
+            for ( amrex::MFIter mfi(realspace_ba, dm_global_fft); mfi.isValid(); ++mfi ){
+
+                // Note: the size of the real-space box and spectral-space box
+                // differ when using real-to-complex FFT. When initializing
+                // the FFT plan, the valid dimensions are those of the real-space box.
+                const amrex::IntVect fft_size = realspace_ba[mfi].length();
+                auto* const complex_array = reinterpret_cast<anyfft::Complex*>(m_spectral[mfi].dataPtr());
+
+                m_forward_plan[mfi] = anyfft::CreatePlan(
+                    fft_size, m_real[mfi].dataPtr(), complex_array,
+                    anyfft::direction::R2C, AMREX_SPACEDIM);
+                m_backward_plan[mfi] = anyfft::CreatePlan(
+                    fft_size, m_real[mfi].dataPtr(), complex_array,
+                    anyfft::direction::C2R, AMREX_SPACEDIM);
+            }
+        }
+
+        ~GlobalFFT () override
+        {
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::DestroyPlan(m_forward_plan[mfi]);
+                ablastr::math::anyfft::DestroyPlan(m_backward_plan[mfi]);
+            }
+        }
+
+        GlobalFFT (GlobalFFT const &) = delete;
+        GlobalFFT& operator= (GlobalFFT const &) = delete;
+        GlobalFFT (GlobalFFT &&) = delete;
+        GlobalFFT& operator= (GlobalFFT &&) = delete;
+
+        amrex::MultiFab& real () override { return m_real; }
+
+        SpectralField& spectral () override { return m_spectral; }
+
+        void forward () override
+        {
+            BL_PROFILE("GlobalFFT::forward");
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_forward_plan[mfi]);
+            }
+        }
+
+        void backward () override
+        {
+            BL_PROFILE("GlobalFFT::backward");
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_backward_plan[mfi]);
+            }
+        }
+
+    private:
+        amrex::MultiFab m_real;
+        SpectralField m_spectral;
+        ablastr::math::anyfft::FFTplans m_forward_plan, m_backward_plan;
+    };
+
+    /** @brief Real-to-complex 3D FFT of the doubled domain, distributed over all MPI ranks
+     *
+     * The real-space data is decomposed in slabs along z, on which the FFTs in the
+     * x-y planes are done. The result is redistributed in slabs along y (all-to-all
+     * communication), and transposed locally so that z is the contiguous index,
+     * for the FFTs along z.
+     */
+    class SlabFFT final : public ConvolutionFFT
+    {
+    public:
+        /** @param[in] realspace_box the doubled domain */
+        explicit SlabFFT (amrex::Box const & realspace_box)
+        {
+            namespace anyfft = ablastr::math::anyfft;
+
+            amrex::IntVect const lo = realspace_box.smallEnd();
+            amrex::IntVect const n = realspace_box.length();
+            int const nkx = n[0]/2 + 1; // real-to-complex FFT along x
+            int const nprocs = amrex::ParallelDescriptor::NProcs();
+            amrex::IndexType const nodal = amrex::IndexType::TheNodeType();
+
+            // Slabs along z: real space, and after the FFTs in the x-y planes
+            int const nslabs_z = std::min(nprocs, n[2]);
+            amrex::Vector<amrex::Box> real_boxes, spectral_z_boxes;
+            amrex::Vector<int> pmap_z;
+            for (int islab = 0; islab < nslabs_z; ++islab) {
+                int const z0 = splitStart(n[2], nslabs_z, islab);
+                int const z1 = splitStart(n[2], nslabs_z, islab+1);
+                real_boxes.emplace_back(
+                    amrex::IntVect(lo[0], lo[1], lo[2]+z0),
+                    amrex::IntVect(lo[0]+n[0]-1, lo[1]+n[1]-1, lo[2]+z1-1), nodal);
+                spectral_z_boxes.emplace_back(
+                    amrex::IntVect(0, 0, z0), amrex::IntVect(nkx-1, n[1]-1, z1-1), nodal);
+                pmap_z.push_back(islab);
+            }
+
+            // Slabs along y: after the FFTs in the x-y planes, and transposed (z, kx, y)
+            int const nslabs_y = std::min(nprocs, n[1]);
+            amrex::Vector<amrex::Box> spectral_y_boxes, transposed_boxes;
+            amrex::Vector<int> pmap_y;
+            for (int islab = 0; islab < nslabs_y; ++islab) {
+                int const y0 = splitStart(n[1], nslabs_y, islab);
+                int const y1 = splitStart(n[1], nslabs_y, islab+1);
+                spectral_y_boxes.emplace_back(
+                    amrex::IntVect(0, y0, 0), amrex::IntVect(nkx-1, y1-1, n[2]-1), nodal);
+                transposed_boxes.emplace_back(
+                    amrex::IntVect(0, 0, y0), amrex::IntVect(n[2]-1, nkx-1, y1-1), nodal);
+                pmap_y.push_back(islab);
+            }
+
+            amrex::DistributionMapping const dm_z(std::move(pmap_z));
+            amrex::DistributionMapping const dm_y(std::move(pmap_y));
+            m_real.define(amrex::BoxArray(amrex::BoxList(std::move(real_boxes))), dm_z, 1, 0);
+            m_spectral_z.define(amrex::BoxArray(amrex::BoxList(std::move(spectral_z_boxes))), dm_z, 1, 0);
+            m_spectral_y.define(amrex::BoxArray(amrex::BoxList(std::move(spectral_y_boxes))), dm_y, 1, 0);
+            m_transposed.define(amrex::BoxArray(amrex::BoxList(std::move(transposed_boxes))), dm_y, 1, 0);
+
+            // FFTs in the x-y planes, batched over the planes of the slab
+            m_plan_r2c.define(m_real.boxArray(), dm_z);
+            m_plan_c2r.define(m_real.boxArray(), dm_z);
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                amrex::IntVect const slab_size = m_real[mfi].box().length();
+                auto* const complex_array = reinterpret_cast<anyfft::Complex*>(m_spectral_z[mfi].dataPtr());
+                m_plan_r2c[mfi] = anyfft::CreatePlan(
+                    slab_size, m_real[mfi].dataPtr(), complex_array,
+                    anyfft::direction::R2C, 2, slab_size[2]);
+                m_plan_c2r[mfi] = anyfft::CreatePlan(
+                    slab_size, m_real[mfi].dataPtr(), complex_array,
+                    anyfft::direction::C2R, 2, slab_size[2]);
+            }
+
+            // FFTs along z, batched over the (kx, y) columns of the slab
+            m_plan_forward_z.define(m_transposed.boxArray(), dm_y);
+            m_plan_backward_z.define(m_transposed.boxArray(), dm_y);
+            for (amrex::MFIter mfi(m_transposed); mfi.isValid(); ++mfi) {
+                amrex::IntVect const column_size = m_transposed[mfi].box().length();
+                int const ncolumns = column_size[1]*column_size[2];
+                auto* const complex_array = reinterpret_cast<anyfft::Complex*>(m_transposed[mfi].dataPtr());
+                m_plan_forward_z[mfi] = anyfft::CreatePlan(
+                    column_size, nullptr, complex_array,
+                    anyfft::direction::C2C_FORWARD, 1, ncolumns);
+                m_plan_backward_z[mfi] = anyfft::CreatePlan(
+                    column_size, nullptr, complex_array,
+                    anyfft::direction::C2C_BACKWARD, 1, ncolumns);
+            }
+        }
+
+        ~SlabFFT () override
+        {
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::DestroyPlan(m_plan_r2c[mfi]);
+                ablastr::math::anyfft::DestroyPlan(m_plan_c2r[mfi]);
+            }
+            for (amrex::MFIter mfi(m_transposed); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::DestroyPlan(m_plan_forward_z[mfi]);
+                ablastr::math::anyfft::DestroyPlan(m_plan_backward_z[mfi]);
+            }
+        }
+
+        SlabFFT (SlabFFT const &) = delete;
+        SlabFFT& operator= (SlabFFT const &) = delete;
+        SlabFFT (SlabFFT &&) = delete;
+        SlabFFT& operator= (SlabFFT &&) = delete;
+
+        /** Real-space data, in slabs along z */
+        amrex::MultiFab& real () override { return m_real; }
+
+        /** Spectral-space data, in slabs along y, with z as the contiguous index */
+        SpectralField& spectral () override { return m_transposed; }
+
+        void forward () override
+        {
+            BL_PROFILE("SlabFFT::forward");
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_plan_r2c[mfi]);
+            }
+            m_spectral_y.ParallelCopy(m_spectral_z);
+            transpose(false);
+            for (amrex::MFIter mfi(m_transposed); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_plan_forward_z[mfi]);
+            }
+        }
+
+        void backward () override
+        {
+            BL_PROFILE("SlabFFT::backward");
+            for (amrex::MFIter mfi(m_transposed); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_plan_backward_z[mfi]);
+            }
+            transpose(true);
+            m_spectral_z.ParallelCopy(m_spectral_y);
+            for (amrex::MFIter mfi(m_real); mfi.isValid(); ++mfi) {
+                ablastr::math::anyfft::Execute(m_plan_c2r[mfi]);
+            }
+        }
+
+    private:
+        /** Local transpose between the (kx, y, z) and (z, kx, y) layouts of the slabs along y */
+        void transpose (bool to_spectral_y)
+        {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+            for (amrex::MFIter mfi(m_spectral_y, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                amrex::Array4<amrex::GpuComplex<amrex::Real>> const arr_y = m_spectral_y.array(mfi);
+                amrex::Array4<amrex::GpuComplex<amrex::Real>> const arr_t = m_transposed.array(mfi);
+                if (to_spectral_y) {
+                    amrex::ParallelFor(mfi.tilebox(),
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept {
+                            arr_y(i,j,k) = arr_t(k,i,j);
+                        });
+                } else {
+                    amrex::ParallelFor(mfi.tilebox(),
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept {
+                            arr_t(k,i,j) = arr_y(i,j,k);
+                        });
+                }
+            }
+        }
+
+        amrex::MultiFab m_real;
+        SpectralField m_spectral_z;
+        SpectralField m_spectral_y;
+        SpectralField m_transposed;
+        ablastr::math::anyfft::FFTplans m_plan_r2c, m_plan_c2r;
+        ablastr::math::anyfft::FFTplans m_plan_forward_z, m_plan_backward_z;
+    };
+
+    /** @brief FFT plans and Green function in spectral space, kept from one call of
+     *         computePhiIGF to the next
+     *
+     * They only depend on the domain and on the (scaled) cell size, and on whether
+     * the FFTs are distributed: they are recomputed when one of these changes.
+     */
+    struct IGFCache
+    {
+        /**
+         * @param[in] a_domain the nodal domain, including guard cells
+         * @param[in] a_cell_size an array of 3 reals dx dy dz
+         * @param[in] a_distributed whether to distribute the FFTs over all MPI ranks
+         */
+        IGFCache (amrex::Box const & a_domain,
+                  std::array<amrex::Real, 3> const & a_cell_size,
+                  bool a_distributed)
+            : domain{a_domain}, cell_size{a_cell_size}, distributed{a_distributed}
+        {
+            amrex::IntVect const n = domain.length();
+
+            // Allocate 2x wider arrays for the convolution of rho with the Green function
+            realspace_box = amrex::Box(
+                domain.smallEnd(), domain.smallEnd() + 2*n - amrex::IntVect(1),
+                amrex::IntVect::TheNodeVector() );
+
+            if (distributed) {
+#if defined(AMREX_USE_SYCL)
+                ABLASTR_ABORT_WITH_MESSAGE(
+                    "The distributed FFT of the IGF Poisson solver is not implemented with SYCL");
+#endif
+                fft = std::make_unique<SlabFFT>(realspace_box);
+            } else {
+                fft = std::make_unique<GlobalFFT>(realspace_box);
+            }
+
+            // FFT of the integrated Green function
+            fillIntegratedGreenFunction( fft->real(), realspace_box, n, cell_size );
+            fft->forward();
+            G_fft.define( fft->spectral().boxArray(), fft->spectral().DistributionMap(), 1, 0 );
+            amrex::Copy( G_fft, fft->spectral(), 0, 0, 1, 0 );
+        }
+
+        /** Whether the cache can be used for a solve with these parameters */
+        [[nodiscard]] bool isValid (amrex::Box const & a_domain,
+                                    std::array<amrex::Real, 3> const & a_cell_size,
+                                    bool a_distributed) const
+        {
+            return domain == a_domain && cell_size == a_cell_size && distributed == a_distributed;
+        }
+
+        amrex::Box domain;
+        std::array<amrex::Real, 3> cell_size;
+        bool distributed;
+        amrex::Box realspace_box;
+        std::unique_ptr<ConvolutionFFT> fft;
+        SpectralField G_fft;
+    };
+
+    /** Cache of computePhiIGF; released at amrex::Finalize, since it holds device memory */
+    std::unique_ptr<IGFCache> igf_cache;
+    bool igf_cache_registered = false;
+}
+
 namespace ablastr::fields {
 
 void
 computePhiIGF ( amrex::MultiFab const & rho,
                 amrex::MultiFab & phi,
                 std::array<amrex::Real, 3> const & cell_size,
-                amrex::BoxArray const & ba )
+                amrex::BoxArray const & ba,
+                bool do_distributed_fft )
 {
     using namespace amrex::literals;
 
@@ -45,152 +467,39 @@ computePhiIGF ( amrex::MultiFab const & rho,
     domain.surroundingNodes(); // get nodal points, since `phi` and `rho` are nodal
     domain.grow( phi.nGrowVect() ); // include guard cells
 
-    int const nx = domain.length(0);
-    int const ny = domain.length(1);
-    int const nz = domain.length(2);
-
-    // Allocate 2x wider arrays for the convolution of rho with the Green function
-    // This also defines the box arrays for the global FFT: contains only one box;
-    amrex::Box const realspace_box = amrex::Box(
-        {domain.smallEnd(0), domain.smallEnd(1), domain.smallEnd(2)},
-        {2*nx-1+domain.smallEnd(0), 2*ny-1+domain.smallEnd(1), 2*nz-1+domain.smallEnd(2)},
-        amrex::IntVect::TheNodeVector() );
-    amrex::BoxArray const realspace_ba = amrex::BoxArray( realspace_box );
-    amrex::Box const spectralspace_box = amrex::Box(
-        {0,0,0},
-        {nx, 2*ny-1, 2*nz-1},
-        amrex::IntVect::TheNodeVector() );
-    amrex::BoxArray const spectralspace_ba = amrex::BoxArray( spectralspace_box );
-    // Define a distribution mapping for the global FFT, with only one box
-    amrex::DistributionMapping dm_global_fft;
-    dm_global_fft.define( realspace_ba );
-    // Allocate required arrays
-    amrex::MultiFab tmp_rho = amrex::MultiFab(realspace_ba, dm_global_fft, 1, 0);
-    tmp_rho.setVal(0);
-    amrex::MultiFab tmp_G = amrex::MultiFab(realspace_ba, dm_global_fft, 1, 0);
-    tmp_G.setVal(0);
-    // Allocate corresponding arrays in Fourier space
-    using SpectralField = amrex::FabArray< amrex::BaseFab< amrex::GpuComplex< amrex::Real > > >;
-    SpectralField tmp_rho_fft = SpectralField( spectralspace_ba, dm_global_fft, 1, 0 );
-    SpectralField tmp_G_fft = SpectralField( spectralspace_ba, dm_global_fft, 1, 0 );
-
-    // Copy from rho to tmp_rho
-    tmp_rho.ParallelCopy( rho, 0, 0, 1, amrex::IntVect::TheZeroVector(), amrex::IntVect::TheZeroVector() );
-
-    // Compute the integrated Green function
-    {
-    BL_PROFILE("Initialize Green function");
-    amrex::BoxArray const domain_ba = amrex::BoxArray( domain );
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (amrex::MFIter mfi(domain_ba, dm_global_fft,amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-
-        amrex::Box const bx = mfi.tilebox();
-
-        amrex::IntVect const lo = realspace_box.smallEnd();
-        amrex::IntVect const hi = realspace_box.bigEnd();
-
-        // Fill values of the Green function
-        amrex::Real const dx = cell_size[0];
-        amrex::Real const dy = cell_size[1];
-        amrex::Real const dz = cell_size[2];
-        amrex::Array4<amrex::Real> const tmp_G_arr = tmp_G.array(mfi);
-        amrex::ParallelFor( bx,
-            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-            {
-                int const i0 = i - lo[0];
-                int const j0 = j - lo[1];
-                int const k0 = k - lo[2];
-                amrex::Real const x = i0*dx;
-                amrex::Real const y = j0*dy;
-                amrex::Real const z = k0*dz;
-
-                amrex::Real const G_value = 1._rt/(4._rt*ablastr::constant::math::pi*ablastr::constant::SI::ep0) * (
-                    IntegratedPotential( x+0.5_rt*dx, y+0.5_rt*dy, z+0.5_rt*dz )
-                  - IntegratedPotential( x-0.5_rt*dx, y+0.5_rt*dy, z+0.5_rt*dz )
-                  - IntegratedPotential( x+0.5_rt*dx, y-0.5_rt*dy, z+0.5_rt*dz )
-                  - IntegratedPotential( x+0.5_rt*dx, y+0.5_rt*dy, z-0.5_rt*dz )
-                  + IntegratedPotential( x+0.5_rt*dx, y-0.5_rt*dy, z-0.5_rt*dz )
-                  + IntegratedPotential( x-0.5_rt*dx, y+0.5_rt*dy, z-0.5_rt*dz )
-                  + IntegratedPotential( x-0.5_rt*dx, y-0.5_rt*dy, z+0.5_rt*dz )
-                  - IntegratedPotential( x-0.5_rt*dx, y-0.5_rt*dy, z-0.5_rt*dz )
-                );
-
-                tmp_G_arr(i,j,k) = G_value;
-                // Fill the rest of the array by periodicity
-                if (i0>0) {tmp_G_arr(hi[0]+1-i0, j         , k         ) = G_value;}
-                if (j0>0) {tmp_G_arr(i         , hi[1]+1-j0, k         ) = G_value;}
-                if (k0>0) {tmp_G_arr(i         , j         , hi[2]+1-k0) = G_value;}
-                if ((i0>0)&&(j0>0)) {tmp_G_arr(hi[0]+1-i0, hi[1]+1-j0, k         ) = G_value;}
-                if ((j0>0)&&(k0>0)) {tmp_G_arr(i         , hi[1]+1-j0, hi[2]+1-k0) = G_value;}
-                if ((i0>0)&&(k0>0)) {tmp_G_arr(hi[0]+1-i0, j         , hi[2]+1-k0) = G_value;}
-                if ((i0>0)&&(j0>0)&&(k0>0)) {tmp_G_arr(hi[0]+1-i0, hi[1]+1-j0, hi[2]+1-k0) = G_value;}
-            }
-        );
+    // Reuse the FFT plans and the Green function of the previous call if possible
+    if (igf_cache && !igf_cache->isValid(domain, cell_size, do_distributed_fft)) {
+        igf_cache.reset(); // release the memory before allocating the new cache
     }
+    if (!igf_cache) {
+        BL_PROFILE("Initialize IGF cache");
+        igf_cache = std::make_unique<IGFCache>(domain, cell_size, do_distributed_fft);
+        if (!igf_cache_registered) {
+            amrex::ExecOnFinalize([] () {
+                igf_cache.reset();
+                igf_cache_registered = false;
+            });
+            igf_cache_registered = true;
+        }
     }
+    ConvolutionFFT& fft = *igf_cache->fft;
 
-    // Perform forward FFTs
-    auto forward_plan_rho = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm_global_fft);
-    auto forward_plan_G = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm_global_fft);
-    // Loop over boxes perform FFTs
-    for ( amrex::MFIter mfi(realspace_ba, dm_global_fft); mfi.isValid(); ++mfi ){
-
-        // Note: the size of the real-space box and spectral-space box
-        // differ when using real-to-complex FFT. When initializing
-        // the FFT plan, the valid dimensions are those of the real-space box.
-        const amrex::IntVect fft_size = realspace_ba[mfi].length();
-
-        // FFT of rho
-        forward_plan_rho[mfi] = ablastr::math::anyfft::CreatePlan(
-            fft_size, tmp_rho[mfi].dataPtr(),
-            reinterpret_cast<ablastr::math::anyfft::Complex*>(tmp_rho_fft[mfi].dataPtr()),
-            ablastr::math::anyfft::direction::R2C, AMREX_SPACEDIM);
-        ablastr::math::anyfft::Execute(forward_plan_rho[mfi]);
-
-        // FFT of G
-        forward_plan_G[mfi] = ablastr::math::anyfft::CreatePlan(
-            fft_size, tmp_G[mfi].dataPtr(),
-            reinterpret_cast<ablastr::math::anyfft::Complex*>(tmp_G_fft[mfi].dataPtr()),
-            ablastr::math::anyfft::direction::R2C, AMREX_SPACEDIM);
-        ablastr::math::anyfft::Execute(forward_plan_G[mfi]);
+    // Copy from rho to the doubled domain, and perform the forward FFT
+    fft.real().setVal(0);
+    fft.real().ParallelCopy( rho, 0, 0, 1, amrex::IntVect::TheZeroVector(), amrex::IntVect::TheZeroVector() );
+    fft.forward();
 
-    }
-
-    // Multiply tmp_G_fft and tmp_rho_fft in spectral space
-    // Store the result in-place in Gtmp_G_fft, to save memory
-    amrex::Multiply( tmp_G_fft, tmp_rho_fft, 0, 0, 1, 0);
+    // Multiply by the FFT of the Green function in spectral space
+    amrex::Multiply( fft.spectral(), igf_cache->G_fft, 0, 0, 1, 0 );
 
     // Perform inverse FFT
-    auto backward_plan = ablastr::math::anyfft::FFTplans(spectralspace_ba, dm_global_fft);
-    // Loop over boxes perform FFTs
-    for ( amrex::MFIter mfi(spectralspace_ba, dm_global_fft); mfi.isValid(); ++mfi ){
-
-        // Note: the size of the real-space box and spectral-space box
-        // differ when using real-to-complex FFT. When initializing
-        // the FFT plan, the valid dimensions are those of the real-space box.
-        const amrex::IntVect fft_size = realspace_ba[mfi].length();
-
-        // Inverse FFT: is done in-place, in the array of G
-        backward_plan[mfi] = ablastr::math::anyfft::CreatePlan(
-            fft_size, tmp_G[mfi].dataPtr(),
-            reinterpret_cast<ablastr::math::anyfft::Complex*>( tmp_G_fft[mfi].dataPtr()),
-            ablastr::math::anyfft::direction::C2R, AMREX_SPACEDIM);
-        ablastr::math::anyfft::Execute(backward_plan[mfi]);
-    }
-    // Normalize, since (FFT + inverse FFT) results in a factor N
-    const amrex::Real normalization = 1._rt / realspace_box.numPts();
-    tmp_G.mult( normalization );
+    fft.backward();
 
-    // Copy from tmp_G to phi
-    phi.ParallelCopy( tmp_G, 0, 0, 1, amrex::IntVect::TheZeroVector(), phi.nGrowVect() );
+    // Normalize, since (FFT + inverse FFT) results in a factor N
+    const amrex::Real normalization = 1._rt / igf_cache->realspace_box.numPts();
+    fft.real().mult( normalization );
 
-    // Loop to destroy FFT plans
-    for ( amrex::MFIter mfi(spectralspace_ba, dm_global_fft); mfi.isValid(); ++mfi ){
-        ablastr::math::anyfft::DestroyPlan(forward_plan_G[mfi]);
-        ablastr::math::anyfft::DestroyPlan(forward_plan_rho[mfi]);
-        ablastr::math::anyfft::DestroyPlan(backward_plan[mfi]);
-    }
+    // Copy to phi
+    phi.ParallelCopy( fft.real(), 0, 0, 1, amrex::IntVect::TheZeroVector(), phi.nGrowVect() );
 }
 } // namespace ablastr::fields
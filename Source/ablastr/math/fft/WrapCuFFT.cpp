@@ -20,22 +20,38 @@ namespace ablastr::math::anyfft
 #ifdef AMREX_USE_FLOAT
     cufftType VendorR2C = CUFFT_R2C;
     cufftType VendorC2R = CUFFT_C2R;
+    cufftType VendorC2C = CUFFT_C2C;
 #else
     cufftType VendorR2C = CUFFT_D2Z;
     cufftType VendorC2R = CUFFT_Z2D;
+    cufftType VendorC2C = CUFFT_Z2Z;
 #endif
 
     std::string cufftErrorToString (const cufftResult& err);
 
     FFTplan CreatePlan(const amrex::IntVect& real_size, amrex::Real * const real_array,
-                       Complex * const complex_array, const direction dir, const int dim)
+                       Complex * const complex_array, const direction dir, const int dim,
+                       const int batch)
     {
         FFTplan fft_plan;
         ABLASTR_PROFILE("ablastr::math::anyfft::CreatePlan");
 
         // Initialize fft_plan.m_plan with the vendor fft plan.
         cufftResult result;
-        if (dir == direction::R2C){
+        if (batch > 1 || dir == direction::C2C_FORWARD || dir == direction::C2C_BACKWARD) {
+            // Several transforms, whose arrays follow each other in memory
+            // (cuFFT uses the contiguous layout when inembed and onembed are null)
+            ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(dim >= 1 && dim <= 3,
+                "only dim=1 and dim=2 and dim=3 have been implemented");
+            int n[3] = {1, 1, 1};
+            for (int idim = 0; idim < dim; ++idim) {
+                n[idim] = real_size[dim-1-idim];
+            }
+            cufftType const type = (dir == direction::R2C) ? VendorR2C :
+                                   (dir == direction::C2R) ? VendorC2R : VendorC2C;
+            result = cufftPlanMany(
+                &(fft_plan.m_plan), dim, n, nullptr, 1, 0, nullptr, 1, 0, type, batch);
+        } else if (dir == direction::R2C){
             if (dim == 3) {
                 result = cufftPlan3d(
                     &(fft_plan.m_plan), real_size[2], real_size[1], real_size[0], VendorR2C);
@@ -100,8 +116,13 @@ namespace ablastr::math::anyfft
             result = cufftExecZ2D(fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_real_array);
 #endif
         } else {
-            ABLASTR_ABORT_WITH_MESSAGE(
-                "direction must be FFTplan::direction::R2C or FFTplan::direction::C2R");
+            // in place
+            int const sign = (fft_plan.m_dir == direction::C2C_FORWARD) ? CUFFT_FORWARD : CUFFT_INVERSE;
+#ifdef AMREX_USE_FLOAT
+            result = cufftExecC2C(fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_complex_array, sign);
+#else
+            result = cufftExecZ2Z(fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_complex_array, sign);
+#endif
         }
         if ( result != CUFFT_SUCCESS ) {
             ABLASTR_ABORT_WITH_MESSAGE(
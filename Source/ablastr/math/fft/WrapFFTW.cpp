@@ -11,14 +11,94 @@
 
 #include <AMReX.H>
 #include <AMReX_IntVect.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
 #include <AMReX_REAL.H>
+#include <AMReX_Utility.H>
+#include <AMReX_Vector.H>
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace ablastr::math::anyfft
 {
 
-    void setup(){/*nothing to do*/}
+    namespace
+    {
+        /** FFTW planner flag: FFTW_MEASURE if ablastr.fftw_plan_measure, FFTW_ESTIMATE otherwise */
+        unsigned int planner_flag = FFTW_ESTIMATE;
+
+        /** File from which the FFTW wisdom is loaded at setup and to which it is saved
+         *  at cleanup (ablastr.fftw_wisdom_file; no file if empty) */
+        std::string wisdom_file;
+
+        /** Whether plans are reused for arrays with the same shape (ablastr.fftw_plan_cache) */
+        bool use_plan_cache = true;
+
+        /** Parameters that define a plan, apart from the arrays: dimensionality, size,
+         *  direction, number of transforms, whether the transform is in place, and alignment
+         *  of the real and complex arrays.
+         *  (The precision is fixed at compile time, and so is the same for all plans.) */
+        using PlanKey = std::tuple<int, std::array<int,3>, direction, int, bool, int, int>;
 
-    void cleanup(){/*nothing to do*/}
+        /** Plans that are kept until cleanup, e.g., across regrids and load balancing,
+         *  and executed on new arrays with the new-array execute functions of FFTW */
+        std::map<PlanKey, VendorFFTPlan> plan_cache;
+
+        /** Plans of plan_cache, which are not destroyed by DestroyPlan */
+        std::set<VendorFFTPlan> cached_plans;
+
+        /** Import the FFTW wisdom of all the ranks into the wisdom of the I/O processor */
+        void MergeWisdom ()
+        {
+#ifdef AMREX_USE_MPI
+#   ifdef AMREX_USE_FLOAT
+            char* const local_wisdom = fftwf_export_wisdom_to_string();
+#   else
+            char* const local_wisdom = fftw_export_wisdom_to_string();
+#   endif
+            // the terminating null character is sent, to separate the wisdom of the ranks
+            const int length = (local_wisdom != nullptr) ?
+                static_cast<int>(std::strlen(local_wisdom)) + 1 : 0;
+
+            const int nprocs = amrex::ParallelDescriptor::NProcs();
+            const int io_proc = amrex::ParallelDescriptor::IOProcessorNumber();
+            std::vector<int> recvcount(nprocs, 0);
+            std::vector<int> disp(nprocs, 0);
+            amrex::ParallelDescriptor::Gather(&length, 1, recvcount.data(), 1, io_proc);
+
+            std::vector<char> recvbuf;
+            if (amrex::ParallelDescriptor::IOProcessor()) {
+                for (int i = 1; i < nprocs; ++i) { disp[i] = disp[i-1] + recvcount[i-1]; }
+                recvbuf.resize(disp[nprocs-1] + recvcount[nprocs-1]);
+            }
+            amrex::ParallelDescriptor::Gatherv(local_wisdom, length, recvbuf.data(),
+                                               recvcount, disp, io_proc);
+            std::free(local_wisdom);
+
+            if (amrex::ParallelDescriptor::IOProcessor()) {
+                for (int i = 0; i < nprocs; ++i) {
+                    if (i == io_proc || recvcount[i] == 0) { continue; }
+#   ifdef AMREX_USE_FLOAT
+                    const int success = fftwf_import_wisdom_from_string(recvbuf.data() + disp[i]);
+#   else
+                    const int success = fftw_import_wisdom_from_string(recvbuf.data() + disp[i]);
+#   endif
+                    if (success == 0) {
+                        amrex::Print() << "Warning: could not merge the FFTW wisdom of rank " << i << "\n";
+                    }
+                }
+            }
+#endif
+        }
+    }
 
 #ifdef AMREX_USE_FLOAT
     const auto VendorCreatePlanR2C3D = fftwf_plan_dft_r2c_3d;
@@ -27,6 +107,9 @@ namespace ablastr::math::anyfft
     const auto VendorCreatePlanC2R2D = fftwf_plan_dft_c2r_2d;
     const auto VendorCreatePlanR2C1D = fftwf_plan_dft_r2c_1d;
     const auto VendorCreatePlanC2R1D = fftwf_plan_dft_c2r_1d;
+    const auto VendorCreatePlanManyR2C = fftwf_plan_many_dft_r2c;
+    const auto VendorCreatePlanManyC2R = fftwf_plan_many_dft_c2r;
+    const auto VendorCreatePlanManyC2C = fftwf_plan_many_dft;
 #else
     const auto VendorCreatePlanR2C3D = fftw_plan_dft_r2c_3d;
     const auto VendorCreatePlanC2R3D = fftw_plan_dft_c2r_3d;
@@ -34,13 +117,109 @@ namespace ablastr::math::anyfft
     const auto VendorCreatePlanC2R2D = fftw_plan_dft_c2r_2d;
     const auto VendorCreatePlanR2C1D = fftw_plan_dft_r2c_1d;
     const auto VendorCreatePlanC2R1D = fftw_plan_dft_c2r_1d;
+    const auto VendorCreatePlanManyR2C = fftw_plan_many_dft_r2c;
+    const auto VendorCreatePlanManyC2R = fftw_plan_many_dft_c2r;
+    const auto VendorCreatePlanManyC2C = fftw_plan_many_dft;
+#endif
+
+    void setup()
+    {
+        const amrex::ParmParse pp_ablastr("ablastr");
+        bool plan_measure = false;
+        pp_ablastr.query("fftw_plan_measure", plan_measure);
+        planner_flag = plan_measure ? FFTW_MEASURE : FFTW_ESTIMATE;
+        pp_ablastr.query("fftw_plan_cache", use_plan_cache);
+        pp_ablastr.query("fftw_wisdom_file", wisdom_file);
+
+        if (wisdom_file.empty()) { return; }
+
+        // The I/O processor reads the wisdom file, and broadcasts it to all ranks
+        int file_exists = 0;
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            file_exists = amrex::FileExists(wisdom_file) ? 1 : 0;
+        }
+        amrex::ParallelDescriptor::Bcast(&file_exists, 1,
+            amrex::ParallelDescriptor::IOProcessorNumber());
+        if (file_exists == 0) { return; }
+
+        amrex::Vector<char> wisdom;
+        amrex::ParallelDescriptor::ReadAndBcastFile(wisdom_file, wisdom);
+        wisdom.push_back('\0');
+#ifdef AMREX_USE_FLOAT
+        const int success = fftwf_import_wisdom_from_string(wisdom.data());
+#else
+        const int success = fftw_import_wisdom_from_string(wisdom.data());
+#endif
+        if (success == 0) {
+            amrex::Print() << "Warning: could not import the FFTW wisdom from " << wisdom_file << "\n";
+        }
+    }
+
+    void cleanup()
+    {
+        // Save the wisdom accumulated by all the ranks (which plan the FFTs of different
+        // box sizes), merged on the I/O processor, for the next runs
+        if (!wisdom_file.empty()) {
+            MergeWisdom();
+            if (amrex::ParallelDescriptor::IOProcessor()) {
+#ifdef AMREX_USE_FLOAT
+                const int success = fftwf_export_wisdom_to_filename(wisdom_file.c_str());
+#else
+                const int success = fftw_export_wisdom_to_filename(wisdom_file.c_str());
 #endif
+                if (success == 0) {
+                    amrex::Print() << "Warning: could not export the FFTW wisdom to " << wisdom_file << "\n";
+                }
+            }
+        }
+
+        for (auto& [key, plan] : plan_cache) {
+#ifdef AMREX_USE_FLOAT
+            fftwf_destroy_plan( plan );
+#else
+            fftw_destroy_plan( plan );
+#endif
+        }
+        plan_cache.clear();
+        // cached_plans is kept, so that plans that are still referenced
+        // (e.g., released at amrex::Finalize) are not destroyed a second time
+    }
 
     FFTplan CreatePlan(const amrex::IntVect& real_size, amrex::Real * const real_array,
-                       Complex * const complex_array, const direction dir, const int dim)
+                       Complex * const complex_array, const direction dir, const int dim,
+                       const int batch)
     {
         FFTplan fft_plan;
 
+        // Store meta-data in fft_plan
+        fft_plan.m_real_array = real_array;
+        fft_plan.m_complex_array = complex_array;
+        fft_plan.m_dir = dir;
+        fft_plan.m_dim = dim;
+
+        // Reuse the plan of arrays with the same shape and alignment, if there is one:
+        // Execute uses the new-array execute functions of FFTW, which only require that
+        // the arrays have the same shape and alignment as those of the plan.
+        PlanKey key;
+        if (use_plan_cache) {
+            std::array<int,3> size = {1, 1, 1};
+            for (int idim = 0; idim < dim; ++idim) { size[idim] = real_size[idim]; }
+#ifdef AMREX_USE_FLOAT
+            const int real_alignment = fftwf_alignment_of(real_array);
+            const int complex_alignment = fftwf_alignment_of(reinterpret_cast<float*>(complex_array));
+#else
+            const int real_alignment = fftw_alignment_of(real_array);
+            const int complex_alignment = fftw_alignment_of(reinterpret_cast<double*>(complex_array));
+#endif
+            const bool in_place = (static_cast<void*>(real_array) == static_cast<void*>(complex_array));
+            key = PlanKey{dim, size, dir, batch, in_place, real_alignment, complex_alignment};
+            auto const it = plan_cache.find(key);
+            if (it != plan_cache.end()) {
+                fft_plan.m_plan = it->second;
+                return fft_plan;
+            }
+        }
+
 #if defined(AMREX_USE_OMP) && defined(WarpX_FFTW_OMP)
 #   ifdef AMREX_USE_FLOAT
         fftwf_init_threads();
@@ -53,16 +232,42 @@ namespace ablastr::math::anyfft
 
         // Initialize fft_plan.m_plan with the vendor fft plan.
         // Swap dimensions: AMReX FAB are Fortran-order but FFTW is C-order
-        if (dir == direction::R2C){
+        if (batch > 1 || dir == direction::C2C_FORWARD || dir == direction::C2C_BACKWARD) {
+            // Several transforms, whose arrays follow each other in memory
+            ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(dim >= 1 && dim <= 3,
+                "only dim=1 and dim=2 and dim=3 have been implemented");
+            int n[3] = {1, 1, 1};
+            int real_dist = 1;
+            for (int idim = 0; idim < dim; ++idim) {
+                n[idim] = real_size[dim-1-idim];
+                real_dist *= real_size[idim];
+            }
+            int const complex_dist = (real_dist / real_size[0]) * (real_size[0]/2 + 1);
+            if (dir == direction::R2C) {
+                fft_plan.m_plan = VendorCreatePlanManyR2C(
+                    dim, n, batch, real_array, nullptr, 1, real_dist,
+                    complex_array, nullptr, 1, complex_dist, planner_flag);
+            } else if (dir == direction::C2R) {
+                fft_plan.m_plan = VendorCreatePlanManyC2R(
+                    dim, n, batch, complex_array, nullptr, 1, complex_dist,
+                    real_array, nullptr, 1, real_dist, planner_flag);
+            } else {
+                // in place; the size of the complex array is real_size
+                fft_plan.m_plan = VendorCreatePlanManyC2C(
+                    dim, n, batch, complex_array, nullptr, 1, real_dist,
+                    complex_array, nullptr, 1, real_dist,
+                    (dir == direction::C2C_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD, planner_flag);
+            }
+        } else if (dir == direction::R2C){
             if (dim == 3) {
                 fft_plan.m_plan = VendorCreatePlanR2C3D(
-                    real_size[2], real_size[1], real_size[0], real_array, complex_array, FFTW_ESTIMATE);
+                    real_size[2], real_size[1], real_size[0], real_array, complex_array, planner_flag);
             } else if (dim == 2) {
                 fft_plan.m_plan = VendorCreatePlanR2C2D(
-                    real_size[1], real_size[0], real_array, complex_array, FFTW_ESTIMATE);
+                    real_size[1], real_size[0], real_array, complex_array, planner_flag);
             } else if (dim == 1) {
                 fft_plan.m_plan = VendorCreatePlanR2C1D(
-                    real_size[0], real_array, complex_array, FFTW_ESTIMATE);
+                    real_size[0], real_array, complex_array, planner_flag);
             } else {
                 ABLASTR_ABORT_WITH_MESSAGE(
                     "only dim=1 and dim=2 and dim=3 have been implemented");
@@ -70,30 +275,31 @@ namespace ablastr::math::anyfft
         } else if (dir == direction::C2R){
             if (dim == 3) {
                 fft_plan.m_plan = VendorCreatePlanC2R3D(
-                    real_size[2], real_size[1], real_size[0], complex_array, real_array, FFTW_ESTIMATE);
+                    real_size[2], real_size[1], real_size[0], complex_array, real_array, planner_flag);
             } else if (dim == 2) {
                 fft_plan.m_plan = VendorCreatePlanC2R2D(
-                    real_size[1], real_size[0], complex_array, real_array, FFTW_ESTIMATE);
+                    real_size[1], real_size[0], complex_array, real_array, planner_flag);
             } else if (dim == 1) {
                 fft_plan.m_plan = VendorCreatePlanC2R1D(
-                    real_size[0], complex_array, real_array, FFTW_ESTIMATE);
+                    real_size[0], complex_array, real_array, planner_flag);
             } else {
                 ABLASTR_ABORT_WITH_MESSAGE(
                     "only dim=1 and dim=2 and dim=3 have been implemented.");
             }
         }
 
-        // Store meta-data in fft_plan
-        fft_plan.m_real_array = real_array;
-        fft_plan.m_complex_array = complex_array;
-        fft_plan.m_dir = dir;
-        fft_plan.m_dim = dim;
+        if (use_plan_cache) {
+            plan_cache[key] = fft_plan.m_plan;
+            cached_plans.insert(fft_plan.m_plan);
+        }
 
         return fft_plan;
     }
 
     void DestroyPlan(FFTplan& fft_plan)
     {
+        // Cached plans are destroyed by cleanup
+        if (cached_plans.count(fft_plan.m_plan) > 0) { return; }
 #  ifdef AMREX_USE_FLOAT
         fftwf_destroy_plan( fft_plan.m_plan );
 #  else
@@ -102,10 +308,23 @@ namespace ablastr::math::anyfft
     }
 
     void Execute(FFTplan& fft_plan){
+        // The plan may have been created for other arrays (see CreatePlan)
 #  ifdef AMREX_USE_FLOAT
-        fftwf_execute( fft_plan.m_plan );
+        if (fft_plan.m_dir == direction::R2C) {
+            fftwf_execute_dft_r2c( fft_plan.m_plan, fft_plan.m_real_array, fft_plan.m_complex_array );
+        } else if (fft_plan.m_dir == direction::C2R) {
+            fftwf_execute_dft_c2r( fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_real_array );
+        } else {
+            fftwf_execute_dft( fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_complex_array );
+        }
 #  else
-        fftw_execute( fft_plan.m_plan );
+        if (fft_plan.m_dir == direction::R2C) {
+            fftw_execute_dft_r2c( fft_plan.m_plan, fft_plan.m_real_array, fft_plan.m_complex_array );
+        } else if (fft_plan.m_dir == direction::C2R) {
+            fftw_execute_dft_c2r( fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_real_array );
+        } else {
+            fftw_execute_dft( fft_plan.m_plan, fft_plan.m_complex_array, fft_plan.m_complex_array );
+        }
 #  endif
     }
 }
@@ -20,11 +20,16 @@ namespace ablastr::math::anyfft
     void cleanup () {/*nothing to do*/}
 
     FFTplan CreatePlan (const amrex::IntVect& real_size, amrex::Real * const real_array,
-                        Complex * const complex_array, const direction dir, const int dim)
+                        Complex * const complex_array, const direction dir, const int dim,
+                        const int batch)
     {
         FFTplan fft_plan;
         ABLASTR_PROFILE("ablastr::math::anyfft::CreatePlan");
 
+        ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(
+            dir == direction::R2C || dir == direction::C2R,
+            "complex-to-complex FFTs are not implemented with oneMKL");
+
         // Initialize fft_plan.m_plan with the vendor fft plan.
         std::vector<std::int64_t> strides(dim+1);
         if (dim == 3) {
@@ -56,6 +61,16 @@ namespace ablastr::math::anyfft
                                    DFTI_NOT_INPLACE);
         fft_plan.m_plan->set_value(oneapi::mkl::dft::config_param::FWD_STRIDES,
                                    strides.data());
+        if (batch > 1) {
+            // Several transforms, whose arrays follow each other in memory
+            std::int64_t real_dist = 1;
+            for (int idim = 0; idim < dim; ++idim) { real_dist *= real_size[idim]; }
+            std::int64_t const complex_dist = (real_dist / real_size[0]) * (real_size[0]/2 + 1);
+            fft_plan.m_plan->set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS,
+                                       std::int64_t(batch));
+            fft_plan.m_plan->set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, real_dist);
+            fft_plan.m_plan->set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE, complex_dist);
+        }
         fft_plan.m_plan->commit(amrex::Gpu::Device::streamQueue());
 
         // Store meta-data in fft_plan
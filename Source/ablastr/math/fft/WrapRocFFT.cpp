@@ -33,7 +33,8 @@ namespace ablastr::math::anyfft
     }
 
     FFTplan CreatePlan (const amrex::IntVect& real_size, amrex::Real * const real_array,
-                        Complex * const complex_array, const direction dir, const int dim)
+                        Complex * const complex_array, const direction dir, const int dim,
+                        const int batch)
     {
         FFTplan fft_plan;
 
@@ -41,19 +42,26 @@ namespace ablastr::math::anyfft
                                                     std::size_t(real_size[1]),
                                                     std::size_t(real_size[2]))};
 
+        // C2C transforms are done in place
+        bool const is_c2c = (dir == direction::C2C_FORWARD) || (dir == direction::C2C_BACKWARD);
+        rocfft_transform_type transform_type = rocfft_transform_type_real_forward;
+        if (dir == direction::C2R) { transform_type = rocfft_transform_type_real_inverse; }
+        else if (dir == direction::C2C_FORWARD) { transform_type = rocfft_transform_type_complex_forward; }
+        else if (dir == direction::C2C_BACKWARD) { transform_type = rocfft_transform_type_complex_inverse; }
+
         // Initialize fft_plan.m_plan with the vendor fft plan.
+        // Without a plan description, the arrays of the batch are contiguous.
         rocfft_status result = rocfft_plan_create(&(fft_plan.m_plan),
-                                                  rocfft_placement_notinplace,
-                                                  (dir == direction::R2C)
-                                                      ? rocfft_transform_type_real_forward
-                                                      : rocfft_transform_type_real_inverse,
+                                                  is_c2c ? rocfft_placement_inplace
+                                                         : rocfft_placement_notinplace,
+                                                  transform_type,
 #ifdef AMREX_USE_FLOAT
                                                   rocfft_precision_single,
 #else
                                                   rocfft_precision_double,
 #endif
                                                   dim, lengths,
-                                                  1, // number of transforms,
+                                                  batch, // number of transforms,
                                                   nullptr);
         assert_rocfft_status("rocfft_plan_create", result);
 
@@ -99,8 +107,10 @@ namespace ablastr::math::anyfft
                                     (void**)&(fft_plan.m_real_array), // out
                                     execinfo);
         } else {
-            ABLASTR_ABORT_WITH_MESSAGE(
-                "direction must be FFTplan::direction::R2C or FFTplan::direction::C2R");
+            result = rocfft_execute(fft_plan.m_plan,
+                                    (void**)&(fft_plan.m_complex_array), // in and out
+                                    nullptr,
+                                    execinfo);
         }
 
         assert_rocfft_status("rocfft_execute", result);
@@ -6,8 +6,14 @@
  */
 #include "Communication.H"
 
+#include "ablastr/utils/TextMsg.H"
+#include "ablastr/utils/counters/Counters.H"
+
+#include <AMReX_Arena.H>
+#include <AMReX_Array4.H>
 #include <AMReX_BaseFab.H>
 #include <AMReX_BLProfiler.H>
+#include <AMReX_Box.H>
 #include <AMReX_IntVect.H>
 #include <AMReX_FabArray.H>
 #include <AMReX_FabArrayUtility.H>
@@ -15,12 +21,156 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_iMultiFab.H>
 #include <AMReX_IndexType.H>
+#include <AMReX_Loop.H>
+#include <AMReX_GpuControl.H>
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_ParallelContext.H>
+#include <AMReX_ParallelDescriptor.H>
 #include <AMReX_ParmParse.H>
+#include <AMReX_TagParallelFor.H>
+
+#ifdef AMREX_USE_MPI
+#   include <mpi.h>
+#endif
 
 #include <algorithm>
+#include <cstddef>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
+namespace
+{
+    /** Add the number of bytes sent to the other MPI ranks when exchanging the guard
+     * cells of mf to a performance counter, estimated from the communication metadata
+     * of FillBoundary (cached by AMReX).
+     *
+     * @param[in] counter name of the performance counter
+     * @param[in] mf data whose guard cells are exchanged
+     * @param[in] ng number of guard cells
+     * @param[in] ncomp number of components exchanged
+     * @param[in] value_size size of a value
+     * @param[in] period periodicity
+     * @param[in] sum_boundary whether the guard cells are sent to the valid cells (SumBoundary),
+     *            rather than the valid cells to the guard cells (FillBoundary)
+     */
+    void CountBytesSent (const std::string& counter, const amrex::FabArrayBase& mf,
+                         const amrex::IntVect& ng, int ncomp, std::size_t value_size,
+                         const amrex::Periodicity& period, bool sum_boundary)
+    {
+        if (!ablastr::utils::counters::Enabled() ||
+            amrex::ParallelDescriptor::NProcs() == 1 || ng.max() == 0) { return; }
+
+        const auto& fb = mf.getFB(ng, period);
+        // SumBoundary sends the regions that FillBoundary receives
+        const auto& tags = sum_boundary ? fb.m_RcvTags : fb.m_SndTags;
+        amrex::Long npts = 0;
+        for (const auto& rank_tags : *tags) {
+            for (const auto& tag : rank_tags.second) { npts += tag.sbox.numPts(); }
+        }
+        ablastr::utils::counters::Add(counter,
+            static_cast<double>(npts)*ncomp*static_cast<double>(value_size));
+    }
+
+    /** Whether shared nodal points are synchronized by FillBoundary
+     *
+     * @param[in] nodal_sync nodal_sync argument of FillBoundary
+     */
+    bool DoNodalSync (std::optional<bool> nodal_sync)
+    {
+        // allow developers to always enforce nodal sync, independent of the
+        // nodal_sync argument
+        const bool do_nodal_sync_arg = nodal_sync.value_or(false);
+
+        const amrex::ParmParse pp_ablastr("ablastr");
+        bool do_nodal_sync_input = false;
+        pp_ablastr.query("fillboundary_always_sync", do_nodal_sync_input);
+
+        // logic: inputs overwrite argument unless argument is true
+        return do_nodal_sync_arg || do_nodal_sync_input;
+    }
+
+    /** Region of a box copied from another box, or to or from a communication buffer */
+    using CopyTag = amrex::Array4CopyTag<amrex::Real>;
+
+#ifdef AMREX_USE_GPU
+    /** Split the tags in batches whose destination regions do not overlap, such that a
+     * tag is in a later batch than all the previous tags whose destination overlaps with it
+     *
+     * @param[in] tags regions to copy
+     * @param[in] threadsafe whether the destination regions of the tags are known not to overlap
+     */
+    amrex::Vector<amrex::Vector<CopyTag>> SplitOverlappingTags (amrex::Vector<CopyTag> const& tags,
+                                                                bool threadsafe)
+    {
+        amrex::Vector<amrex::Vector<CopyTag>> batches;
+        if (threadsafe) {
+            batches.push_back(tags);
+            return batches;
+        }
+        std::map<amrex::Real*, std::vector<int>> tags_of_fab;
+        std::vector<int> batch_of_tag(tags.size(), 0);
+        for (int it = 0; it < static_cast<int>(tags.size()); ++it) {
+            auto& previous_tags = tags_of_fab[tags[it].dfab.p];
+            int batch = 0;
+            for (const int ip : previous_tags) {
+                if (tags[ip].dbox.intersects(tags[it].dbox)) {
+                    batch = std::max(batch, batch_of_tag[ip] + 1);
+                }
+            }
+            previous_tags.push_back(it);
+            batch_of_tag[it] = batch;
+            if (batch >= static_cast<int>(batches.size())) { batches.resize(batch + 1); }
+            batches[batch].push_back(tags[it]);
+        }
+        return batches;
+    }
+#endif
+
+    /** Copy the regions of all the tags, which can belong to different MultiFabs
+     *
+     * On GPU, the tags are copied by a single kernel launch (or one launch per batch of
+     * non-overlapping tags). On CPU, as in FabArray::FB_local_copy_cpu, the tags are
+     * copied by several OpenMP threads only if their destination regions do not overlap.
+     *
+     * @param[in] tags regions to copy
+     * @param[in] threadsafe whether the destination regions of the tags are known not to overlap
+     */
+    void CopyTags (amrex::Vector<CopyTag> const& tags, bool threadsafe)
+    {
+        if (tags.empty()) { return; }
+#ifdef AMREX_USE_GPU
+        if (amrex::Gpu::inLaunchRegion())
+        {
+            for (auto const& batch : SplitOverlappingTags(tags, threadsafe)) {
+                amrex::ParallelFor(batch,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k, CopyTag const& tag) noexcept
+                    {
+                        for (int n = 0; n < tag.dfab.nComp(); ++n) {
+                            tag.dfab(i,j,k,n) = tag.sfab(i+tag.offset.x, j+tag.offset.y, k+tag.offset.z, n);
+                        }
+                    });
+            }
+            return;
+        }
+#endif
+        const int ntags = static_cast<int>(tags.size());
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (threadsafe)
+#endif
+        for (int it = 0; it < ntags; ++it)
+        {
+            CopyTag const& tag = tags[it];
+            amrex::LoopConcurrentOnCpu(tag.dbox, tag.dfab.nComp(),
+                [&] (int i, int j, int k, int n) noexcept
+                {
+                    tag.dfab(i,j,k,n) = tag.sfab(i+tag.offset.x, j+tag.offset.y, k+tag.offset.z, n);
+                });
+        }
+    }
+}
+
 
 namespace ablastr::utils::communication
 {
@@ -76,16 +226,11 @@ void FillBoundary (amrex::MultiFab &mf,
 {
     BL_PROFILE("ablastr::utils::communication::FillBoundary");
 
-    // allow developers to always enforce nodal sync, independent of the
-    // nodal_sync argument
-    const bool do_nodal_sync_arg = nodal_sync.value_or(false);
+    bool const do_nodal_sync = DoNodalSync(nodal_sync);
 
-    const amrex::ParmParse pp_ablastr("ablastr");
-    bool do_nodal_sync_input = false;
-    pp_ablastr.query("fillboundary_always_sync", do_nodal_sync_input);
-
-    // logic: inputs overwrite argument unless argument is true
-    bool const do_nodal_sync = do_nodal_sync_arg || do_nodal_sync_input;
+    CountBytesSent("fillboundary_bytes_sent", mf, ng, mf.nComp(),
+                   do_single_precision_comms ? sizeof(comm_float_type) : sizeof(amrex::Real),
+                   period, false);
 
     if (do_single_precision_comms)
     {
@@ -129,6 +274,179 @@ FillBoundary (amrex::Vector<amrex::MultiFab *> const &mf, bool do_single_precisi
     }
 }
 
+void
+FillBoundaryAggregated (amrex::Vector<amrex::MultiFab*> const& mf,
+                        amrex::Vector<amrex::IntVect> const& ng,
+                        amrex::Vector<amrex::Periodicity> const& period,
+                        bool do_single_precision_comms,
+                        std::optional<bool> nodal_sync)
+{
+    BL_PROFILE("ablastr::utils::communication::FillBoundaryAggregated");
+
+    const int nmf = static_cast<int>(mf.size());
+    ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(
+        static_cast<int>(ng.size()) == nmf && static_cast<int>(period.size()) == nmf,
+        "FillBoundaryAggregated: mf, ng and period must have the same size");
+
+    const amrex::ParmParse pp_ablastr("ablastr");
+    bool do_aggregate = false;
+    pp_ablastr.query("fillboundary_aggregate", do_aggregate);
+
+    // The aggregated exchange sends the values in double precision (if WarpX is built in double
+    // precision) and uses the ranks of the distribution mappings as ranks of the MPI communicator
+    const bool use_aggregated_exchange = do_aggregate && !do_single_precision_comms
+        && amrex::ParallelDescriptor::NProcs() > 1
+        && amrex::ParallelContext::CommunicatorSub() == amrex::ParallelDescriptor::Communicator();
+
+#ifdef AMREX_USE_MPI
+    if (use_aggregated_exchange)
+    {
+        const bool do_nodal_sync = DoNodalSync(nodal_sync);
+
+        // Communication metadata of FillBoundary (cached by AMReX), and number of values
+        // sent to and received from each MPI rank, for all the MultiFabs together
+        std::vector<amrex::FabArrayBase::FB const*> fbs(nmf, nullptr);
+        std::map<int, amrex::Long> send_size;
+        std::map<int, amrex::Long> recv_size;
+        for (int i = 0; i < nmf; ++i)
+        {
+            ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(ng[i].allLE(mf[i]->nGrowVect()),
+                "FillBoundaryAggregated: requested more guard cells than allocated");
+            // as in FillBoundaryAndSync, the shared nodal points are overwritten by the values of the owner box
+            const bool override_sync = do_nodal_sync && !mf[i]->is_cell_centered();
+            if (ng[i].max() == 0 && !override_sync) { continue; }
+            fbs[i] = &mf[i]->getFB(ng[i], period[i], false, false, override_sync);
+            const int ncomp = mf[i]->nComp();
+            for (const auto& [rank, tags] : *fbs[i]->m_SndTags) {
+                for (const auto& tag : tags) { send_size[rank] += tag.sbox.numPts()*ncomp; }
+            }
+            for (const auto& [rank, tags] : *fbs[i]->m_RcvTags) {
+                for (const auto& tag : tags) { recv_size[rank] += tag.dbox.numPts()*ncomp; }
+            }
+        }
+
+        amrex::Long total_send_size = 0;
+        for (const auto& rank_size : send_size) { total_send_size += rank_size.second; }
+        amrex::Long total_recv_size = 0;
+        for (const auto& rank_size : recv_size) { total_recv_size += rank_size.second; }
+
+        if (ablastr::utils::counters::Enabled()) {
+            ablastr::utils::counters::Add("fillboundary_bytes_sent",
+                static_cast<double>(total_send_size)*static_cast<double>(sizeof(amrex::Real)));
+        }
+
+        amrex::Arena* const comm_arena = amrex::The_Comm_Arena();
+        auto* const send_buffer = (total_send_size > 0) ? static_cast<amrex::Real*>(
+            comm_arena->alloc(total_send_size*sizeof(amrex::Real))) : nullptr;
+        auto* const recv_buffer = (total_recv_size > 0) ? static_cast<amrex::Real*>(
+            comm_arena->alloc(total_recv_size*sizeof(amrex::Real))) : nullptr;
+
+        // Regions of the boxes in the buffers: for each MPI rank, the tags of all the MultiFabs
+        // one after the other, in the same order on the sending and on the receiving rank
+        amrex::Vector<CopyTag> send_tags;
+        amrex::Vector<CopyTag> recv_tags;
+        std::vector<amrex::Long> send_offset;
+        std::vector<amrex::Long> recv_offset;
+        amrex::Long offset = 0;
+        for (const auto& rank_size : send_size) {
+            send_offset.push_back(offset);
+            for (int i = 0; i < nmf; ++i) {
+                if (!fbs[i]) { continue; }
+                const auto it = fbs[i]->m_SndTags->find(rank_size.first);
+                if (it == fbs[i]->m_SndTags->end()) { continue; }
+                for (const auto& tag : it->second) {
+                    send_tags.push_back(CopyTag{amrex::makeArray4(send_buffer + offset, tag.sbox, mf[i]->nComp()),
+                                                mf[i]->const_array(tag.srcIndex), tag.sbox, amrex::Dim3{0,0,0}});
+                    offset += tag.sbox.numPts()*mf[i]->nComp();
+                }
+            }
+        }
+        offset = 0;
+        for (const auto& rank_size : recv_size) {
+            recv_offset.push_back(offset);
+            for (int i = 0; i < nmf; ++i) {
+                if (!fbs[i]) { continue; }
+                const auto it = fbs[i]->m_RcvTags->find(rank_size.first);
+                if (it == fbs[i]->m_RcvTags->end()) { continue; }
+                for (const auto& tag : it->second) {
+                    recv_tags.push_back(CopyTag{mf[i]->array(tag.dstIndex),
+                                                amrex::makeArray4<amrex::Real const>(recv_buffer + offset, tag.dbox,
+                                                                                     mf[i]->nComp()),
+                                                tag.dbox, amrex::Dim3{0,0,0}});
+                    offset += tag.dbox.numPts()*mf[i]->nComp();
+                }
+            }
+        }
+
+        const int mpi_tag = amrex::ParallelDescriptor::SeqNum();
+        MPI_Comm const comm = amrex::ParallelDescriptor::Communicator();
+        MPI_Datatype const mpi_type = amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+
+        // Post the receives, one message per MPI rank
+        std::vector<MPI_Request> recv_requests(recv_size.size(), MPI_REQUEST_NULL);
+        int irank = 0;
+        for (const auto& [rank, size] : recv_size) {
+            BL_MPI_REQUIRE( MPI_Irecv(recv_buffer + recv_offset[irank], static_cast<int>(size), mpi_type,
+                                      rank, mpi_tag, comm, &recv_requests[irank]) );
+            ++irank;
+        }
+
+        // Pack the send buffer (the regions of the buffer do not overlap)
+        CopyTags(send_tags, true);
+        amrex::Gpu::streamSynchronize();
+
+        // Send, one message per MPI rank
+        std::vector<MPI_Request> send_requests(send_size.size(), MPI_REQUEST_NULL);
+        irank = 0;
+        for (const auto& [rank, size] : send_size) {
+            BL_MPI_REQUIRE( MPI_Isend(send_buffer + send_offset[irank], static_cast<int>(size), mpi_type,
+                                      rank, mpi_tag, comm, &send_requests[irank]) );
+            ++irank;
+        }
+
+        // Copy between the boxes on this MPI rank, while the messages are in flight. The
+        // destination regions can overlap, e.g. for nodal fields (see FB::m_threadsafe_loc)
+        amrex::Vector<CopyTag> local_tags;
+        bool local_threadsafe = true;
+        for (int i = 0; i < nmf; ++i) {
+            if (!fbs[i]) { continue; }
+            local_threadsafe = local_threadsafe && fbs[i]->m_threadsafe_loc;
+            for (const auto& tag : *fbs[i]->m_LocTags) {
+                local_tags.push_back(CopyTag{mf[i]->array(tag.dstIndex), mf[i]->const_array(tag.srcIndex),
+                                             tag.dbox, (tag.sbox.smallEnd() - tag.dbox.smallEnd()).dim3()});
+            }
+        }
+        CopyTags(local_tags, local_threadsafe);
+
+        // Unpack the receive buffer
+        if (!recv_requests.empty()) {
+            BL_MPI_REQUIRE( MPI_Waitall(static_cast<int>(recv_requests.size()), recv_requests.data(),
+                                        MPI_STATUSES_IGNORE) );
+        }
+        bool recv_threadsafe = true;
+        for (int i = 0; i < nmf; ++i) {
+            if (fbs[i]) { recv_threadsafe = recv_threadsafe && fbs[i]->m_threadsafe_rcv; }
+        }
+        CopyTags(recv_tags, recv_threadsafe);
+        amrex::Gpu::streamSynchronize();
+
+        if (!send_requests.empty()) {
+            BL_MPI_REQUIRE( MPI_Waitall(static_cast<int>(send_requests.size()), send_requests.data(),
+                                        MPI_STATUSES_IGNORE) );
+        }
+        if (send_buffer) { comm_arena->free(send_buffer); }
+        if (recv_buffer) { comm_arena->free(recv_buffer); }
+        return;
+    }
+#else
+    amrex::ignore_unused(use_aggregated_exchange);
+#endif
+
+    for (int i = 0; i < nmf; ++i) {
+        ablastr::utils::communication::FillBoundary(*mf[i], ng[i], do_single_precision_comms, period[i], nodal_sync);
+    }
+}
+
 void FillBoundary (amrex::iMultiFab &imf, const amrex::Periodicity &period)
 {
     BL_PROFILE("ablastr::utils::communication::FillBoundary::iMultiFab");
@@ -156,6 +474,10 @@ SumBoundary (amrex::MultiFab &mf,
 {
     BL_PROFILE("ablastr::utils::communication::SumBoundary");
 
+    CountBytesSent("sumboundary_bytes_sent", mf, src_ng, num_comps,
+                   do_single_precision_comms ? sizeof(comm_float_type) : sizeof(amrex::Real),
+                   period, true);
+
     if (do_single_precision_comms)
     {
         amrex::FabArray<amrex::BaseFab<comm_float_type> > mf_tmp(mf.boxArray(),
@@ -174,6 +496,29 @@ SumBoundary (amrex::MultiFab &mf,
     }
 }
 
+void
+SumBoundary_nowait (amrex::MultiFab &mf,
+                    int start_comp,
+                    int num_comps,
+                    amrex::IntVect src_ng,
+                    amrex::IntVect dst_ng,
+                    const amrex::Periodicity &period)
+{
+    BL_PROFILE("ablastr::utils::communication::SumBoundary_nowait");
+
+    CountBytesSent("sumboundary_bytes_sent", mf, src_ng, num_comps, sizeof(amrex::Real), period, true);
+
+    mf.SumBoundary_nowait(start_comp, num_comps, src_ng, dst_ng, period);
+}
+
+void
+SumBoundary_finish (amrex::MultiFab &mf)
+{
+    BL_PROFILE("ablastr::utils::communication::SumBoundary_finish");
+
+    mf.SumBoundary_finish();
+}
+
 void OverrideSync (amrex::MultiFab &mf,
                    bool do_single_precision_comms,
                    const amrex::Periodicity &period)
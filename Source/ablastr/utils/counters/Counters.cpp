@@ -0,0 +1,111 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "Counters.H"
+
+#include <AMReX_GpuDevice.H>
+#include <AMReX_ParallelDescriptor.H>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+    std::atomic<bool> g_enabled{false};
+
+    std::atomic<bool> g_synchronize_timers{false};
+
+    std::mutex g_mutex;
+
+    /** The counters of this MPI rank (guarded by g_mutex) */
+    std::map<std::string, double>& GetCounters ()
+    {
+        static std::map<std::string, double> counters;
+        return counters;
+    }
+}
+
+namespace ablastr::utils::counters
+{
+
+void
+SetEnabled (bool enabled) noexcept
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+Enabled () noexcept
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void
+SetSynchronizeTimers (bool synchronize) noexcept
+{
+    g_synchronize_timers.store(synchronize, std::memory_order_relaxed);
+}
+
+bool
+SynchronizeTimers () noexcept
+{
+    return g_synchronize_timers.load(std::memory_order_relaxed);
+}
+
+void
+Add (const std::string& name, double value)
+{
+    if (!Enabled()) { return; }
+
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    GetCounters()[name] += value;
+}
+
+std::map<std::string, double>
+Values ()
+{
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    return GetCounters();
+}
+
+void
+Reset ()
+{
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    for (auto& counter : GetCounters()) { counter.second = 0.0; }
+}
+
+ScopedTimer::ScopedTimer (std::string name)
+{
+    if (!Enabled() || name.empty()) { return; }
+    m_name = std::move(name);
+    if (SynchronizeTimers()) { amrex::Gpu::synchronize(); }
+    m_start_time = amrex::ParallelDescriptor::second();
+}
+
+ScopedTimer::ScopedTimer (double& accumulator)
+{
+    if (!Enabled()) { return; }
+    m_accumulator = &accumulator;
+    if (SynchronizeTimers()) { amrex::Gpu::synchronize(); }
+    m_start_time = amrex::ParallelDescriptor::second();
+}
+
+ScopedTimer::~ScopedTimer ()
+{
+    if (m_name.empty() && !m_accumulator) { return; }
+    if (SynchronizeTimers()) { amrex::Gpu::synchronize(); }
+    const double duration = amrex::ParallelDescriptor::second() - m_start_time;
+    if (m_accumulator) {
+        *m_accumulator += duration;
+    } else {
+        Add(m_name, duration);
+    }
+}
+
+}
@@ -0,0 +1,621 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+/* Standalone micro-benchmarks of the particle and field kernels of WarpX.
+ *
+ * Each kernel is run in isolation on a single box, without a WarpX instance,
+ * and timed over several repetitions. The results (time per call, items per
+ * second and the minimal memory traffic per item) are written as JSON.
+ *
+ * Runtime parameters (prefix "bench."):
+ *  - n_cell:  number of cells in each direction (default: 64 in 3D, 256 in 2D, 4096 in 1D)
+ *  - ppc:     number of macroparticles per cell (default: 8)
+ *  - repeat:  number of timed repetitions of each kernel (default: 10)
+ *  - orders:  particle shape orders to benchmark (default: 1 2 3)
+ *  - kernels: names of the kernels to run (default: all)
+ *  - output:  name of the JSON file (default: warpx_bench.json)
+ */
+
+#include "EmbeddedBoundary/WarpXFaceInfoBox.H"
+#include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceSolver.H"
+#include "Filter/BilinearFilter.H"
+#include "Particles/Deposition/ChargeDeposition.H"
+#include "Particles/Deposition/CurrentDeposition.H"
+#include "Particles/Gather/FieldGather.H"
+#include "Particles/Pusher/GetAndSetPosition.H"
+#include "Particles/Pusher/UpdateMomentumBoris.H"
+#include "Particles/Pusher/UpdateMomentumHigueraCary.H"
+#include "Particles/Pusher/UpdateMomentumVay.H"
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXAlgorithmSelection.H"
+#include "Utils/WarpXConst.H"
+
+#include <ablastr/utils/Enums.H>
+
+#include <AMReX.H>
+#include <AMReX_BoxArray.H>
+#include <AMReX_DistributionMapping.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_GpuContainers.H>
+#include <AMReX_GpuDevice.H>
+#include <AMReX_LayoutData.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_OpenMP.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Random.H>
+#include <AMReX_Vector.H>
+#include <AMReX_iMultiFab.H>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace amrex::literals;
+
+namespace
+{
+    /** Timing of one kernel, for one set of parameters */
+    struct BenchResult
+    {
+        std::string kernel;
+        int order = 0;
+        amrex::Long n_items = 0;
+        std::string unit;
+        double time_min = 0.;
+        double time_mean = 0.;
+        double bytes_per_item = 0.;
+    };
+
+    /** Parameters of the benchmarks and data shared by the kernels */
+    struct BenchSetup
+    {
+        amrex::Box domain;
+        int ng = 0;
+        amrex::Real dt = 0._rt;
+        std::array<amrex::Real,3> cell_size = {1._rt, 1._rt, 1._rt};
+        amrex::XDim3 dinv;
+        amrex::XDim3 xyzmin;
+        amrex::Dim3 lo;
+        long np = 0;
+
+        amrex::Gpu::DeviceVector<amrex::ParticleReal> x, y, z, theta, w, ux, uy, uz;
+        amrex::Gpu::DeviceVector<amrex::ParticleReal> Exp, Eyp, Ezp, Bxp, Byp, Bzp;
+
+        /** Index types of the fields on the Yee grid */
+        std::array<amrex::IndexType,3> e_type, b_type;
+    };
+
+    /** Number of particle position components read by the kernels */
+#if defined(WARPX_DIM_3D)
+    constexpr int n_pos = 3;
+    constexpr char const* dims_name = "3";
+#elif defined(WARPX_DIM_RZ)
+    constexpr int n_pos = 3;
+    constexpr char const* dims_name = "RZ";
+#elif defined(WARPX_DIM_XZ)
+    constexpr int n_pos = 2;
+    constexpr char const* dims_name = "2";
+#else
+    constexpr int n_pos = 1;
+    constexpr char const* dims_name = "1";
+#endif
+
+    /** Time `f` (after one warm-up call) and return the minimum and mean over `repeat` calls */
+    template <typename F>
+    std::pair<double,double> timeKernel (int repeat, F&& f)
+    {
+        f();
+        amrex::Gpu::streamSynchronize();
+        double tmin = std::numeric_limits<double>::max();
+        double tsum = 0.;
+        for (int r = 0; r < repeat; ++r) {
+            const double t0 = amrex::second();
+            f();
+            amrex::Gpu::streamSynchronize();
+            const double t = amrex::second() - t0;
+            tmin = std::min(tmin, t);
+            tsum += t;
+        }
+        amrex::ParallelAllReduce::Max(tmin, amrex::ParallelDescriptor::Communicator());
+        amrex::ParallelAllReduce::Max(tsum, amrex::ParallelDescriptor::Communicator());
+        return {tmin, tsum/repeat};
+    }
+
+    /** Index type of the component `dir` of the electric (`is_E`) or magnetic field on the Yee grid */
+    amrex::IndexType yeeType (int dir, bool is_E)
+    {
+        // In 2D, the components are (x,y,z) but the directions are (x,z);
+        // in 1D, the only direction is z.
+        amrex::IntVect type(AMREX_D_DECL(1,1,1));
+#if defined(WARPX_DIM_3D)
+        const std::array<int,3> idim = {0, 1, 2};
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+        const std::array<int,3> idim = {0, -1, 1};
+#else
+        const std::array<int,3> idim = {-1, -1, 0};
+#endif
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            // E_i is cell-centered along i, B_i is cell-centered along all directions but i
+            const bool along = (idim[dir] == d);
+            if (along == is_E) { type[d] = 0; }
+        }
+        return amrex::IndexType(type);
+    }
+
+    amrex::FArrayBox makeFab (BenchSetup const& s, amrex::IndexType type, amrex::Real val)
+    {
+        amrex::FArrayBox fab(amrex::convert(amrex::grow(s.domain, s.ng), type), 1);
+        fab.setVal<amrex::RunOn::Device>(val);
+        return fab;
+    }
+
+    GetParticlePosition<PIdx> getPosition (BenchSetup const& s)
+    {
+        GetParticlePosition<PIdx> gp;
+#if defined(WARPX_DIM_3D)
+        gp.m_x = s.x.dataPtr();
+        gp.m_y = s.y.dataPtr();
+        gp.m_z = s.z.dataPtr();
+#elif defined(WARPX_DIM_XZ)
+        gp.m_x = s.x.dataPtr();
+        gp.m_z = s.z.dataPtr();
+#elif defined(WARPX_DIM_RZ)
+        gp.m_x = s.x.dataPtr();
+        gp.m_z = s.z.dataPtr();
+        gp.m_theta = s.theta.dataPtr();
+#else
+        gp.m_z = s.z.dataPtr();
+#endif
+        return gp;
+    }
+
+    void initParticles (BenchSetup& s, int ppc)
+    {
+        s.np = static_cast<long>(s.domain.numPts()) * ppc;
+        for (auto* v : {&s.x, &s.y, &s.z, &s.theta, &s.w, &s.ux, &s.uy, &s.uz,
+                        &s.Exp, &s.Eyp, &s.Ezp, &s.Bxp, &s.Byp, &s.Bzp}) {
+            v->resize(s.np);
+        }
+
+        // Particles are uniformly distributed inside the valid cells,
+        // with momenta small enough to stay within the guard cells during one step
+        auto* AMREX_RESTRICT xp = s.x.dataPtr();
+        auto* AMREX_RESTRICT yp = s.y.dataPtr();
+        auto* AMREX_RESTRICT zp = s.z.dataPtr();
+        auto* AMREX_RESTRICT thetap = s.theta.dataPtr();
+        auto* AMREX_RESTRICT wp = s.w.dataPtr();
+        auto* AMREX_RESTRICT uxp = s.ux.dataPtr();
+        auto* AMREX_RESTRICT uyp = s.uy.dataPtr();
+        auto* AMREX_RESTRICT uzp = s.uz.dataPtr();
+        const amrex::Box domain = s.domain;
+        const amrex::XDim3 dinv = s.dinv;
+        const amrex::XDim3 xyzmin = s.xyzmin;
+        const int ng = s.ng;
+        amrex::ParallelForRNG(s.np,
+            [=] AMREX_GPU_DEVICE (long ip, amrex::RandomEngine const& engine) noexcept
+            {
+                constexpr amrex::ParticleReal umax = 0.3_prt*PhysConst::c;
+                const long icell = ip / ppc;
+                amrex::IntVect iv = domain.atOffset(icell);
+                amrex::ignore_unused(thetap, yp, xp);
+#if defined(WARPX_DIM_3D)
+                xp[ip] = static_cast<amrex::ParticleReal>(xyzmin.x + (iv[0] + ng + amrex::Random(engine))/dinv.x);
+                yp[ip] = static_cast<amrex::ParticleReal>(xyzmin.y + (iv[1] + ng + amrex::Random(engine))/dinv.y);
+                zp[ip] = static_cast<amrex::ParticleReal>(xyzmin.z + (iv[2] + ng + amrex::Random(engine))/dinv.z);
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+                xp[ip] = static_cast<amrex::ParticleReal>(xyzmin.x + (iv[0] + ng + amrex::Random(engine))/dinv.x);
+                zp[ip] = static_cast<amrex::ParticleReal>(xyzmin.z + (iv[1] + ng + amrex::Random(engine))/dinv.z);
+#   if defined(WARPX_DIM_RZ)
+                thetap[ip] = static_cast<amrex::ParticleReal>(2._rt*MathConst::pi*amrex::Random(engine));
+#   endif
+#else
+                zp[ip] = static_cast<amrex::ParticleReal>(xyzmin.z + (iv[0] + ng + amrex::Random(engine))/dinv.z);
+#endif
+                wp[ip] = 1.e10_prt;
+                uxp[ip] = umax*(2._prt*amrex::Random(engine) - 1._prt);
+                uyp[ip] = umax*(2._prt*amrex::Random(engine) - 1._prt);
+                uzp[ip] = umax*(2._prt*amrex::Random(engine) - 1._prt);
+            });
+        amrex::Gpu::streamSynchronize();
+    }
+
+    template <int order>
+    void benchDeposition (BenchSetup const& s, int repeat, std::vector<BenchResult>& results,
+                          std::vector<std::string> const& kernels)
+    {
+        auto selected = [&] (std::string const& name) {
+            return kernels.empty() || std::find(kernels.begin(), kernels.end(), name) != kernels.end();
+        };
+        const auto gp = getPosition(s);
+        const amrex::ParticleReal q = -PhysConst::q_e;
+        constexpr double sz = sizeof(amrex::ParticleReal);
+
+        if (selected("doDepositionShapeN")) {
+            auto jx = makeFab(s, s.e_type[0], 0._rt);
+            auto jy = makeFab(s, s.e_type[1], 0._rt);
+            auto jz = makeFab(s, s.e_type[2], 0._rt);
+            const auto t = timeKernel(repeat, [&] () {
+                doDepositionShapeN<order>(gp, s.w.dataPtr(), s.ux.dataPtr(), s.uy.dataPtr(), s.uz.dataPtr(),
+                    nullptr, jx, jy, jz, s.np, 0._rt, s.dinv, s.xyzmin, s.lo, q, 1);
+            });
+            results.push_back({"doDepositionShapeN", order, s.np, "particles",
+                               t.first, t.second, (n_pos + 4)*sz});
+        }
+        if (selected("doEsirkepovDepositionShapeN")) {
+            auto jx = makeFab(s, s.e_type[0], 0._rt);
+            auto jy = makeFab(s, s.e_type[1], 0._rt);
+            auto jz = makeFab(s, s.e_type[2], 0._rt);
+            const auto t = timeKernel(repeat, [&] () {
+                doEsirkepovDepositionShapeN<order>(gp, s.w.dataPtr(), s.ux.dataPtr(), s.uy.dataPtr(), s.uz.dataPtr(),
+                    nullptr, jx.array(), jy.array(), jz.array(), s.np, s.dt, 0._rt, s.dinv, s.xyzmin, s.lo, q, 1);
+            });
+            results.push_back({"doEsirkepovDepositionShapeN", order, s.np, "particles",
+                               t.first, t.second, (n_pos + 4)*sz});
+        }
+#if defined(WARPX_DIM_3D) || defined(WARPX_DIM_XZ)
+        // Vay deposition is only implemented in Cartesian 2D and 3D
+        if (selected("doVayDepositionShapeN")) {
+            const amrex::IndexType node = amrex::IndexType::TheNodeType();
+            auto dx = makeFab(s, node, 0._rt);
+            auto dy = makeFab(s, node, 0._rt);
+            auto dz = makeFab(s, node, 0._rt);
+            const auto t = timeKernel(repeat, [&] () {
+                doVayDepositionShapeN<order>(gp, s.w.dataPtr(), s.ux.dataPtr(), s.uy.dataPtr(), s.uz.dataPtr(),
+                    nullptr, dx, dy, dz, s.np, s.dt, 0._rt, s.dinv, s.xyzmin, s.lo, q, 1);
+            });
+            results.push_back({"doVayDepositionShapeN", order, s.np, "particles",
+                               t.first, t.second, (n_pos + 4)*sz});
+        }
+#endif
+        if (selected("doChargeDepositionShapeN")) {
+            auto rho = makeFab(s, amrex::IndexType::TheNodeType(), 0._rt);
+            const auto t = timeKernel(repeat, [&] () {
+                doChargeDepositionShapeN<order>(gp, s.w.dataPtr(), nullptr, rho, s.np,
+                    s.dinv, s.xyzmin, s.lo, q, 1);
+            });
+            results.push_back({"doChargeDepositionShapeN", order, s.np, "particles",
+                               t.first, t.second, (n_pos + 1)*sz});
+        }
+    }
+
+    template <int order>
+    void benchGather (BenchSetup& s, int repeat, std::vector<BenchResult>& results)
+    {
+        const auto ex = makeFab(s, s.e_type[0], 1.e9_rt);
+        const auto ey = makeFab(s, s.e_type[1], 1.e9_rt);
+        const auto ez = makeFab(s, s.e_type[2], 1.e9_rt);
+        const auto bx = makeFab(s, s.b_type[0], 1._rt);
+        const auto by = makeFab(s, s.b_type[1], 1._rt);
+        const auto bz = makeFab(s, s.b_type[2], 1._rt);
+        const auto ex_arr = ex.const_array();
+        const auto ey_arr = ey.const_array();
+        const auto ez_arr = ez.const_array();
+        const auto bx_arr = bx.const_array();
+        const auto by_arr = by.const_array();
+        const auto bz_arr = bz.const_array();
+        const auto ex_type = s.e_type[0], ey_type = s.e_type[1], ez_type = s.e_type[2];
+        const auto bx_type = s.b_type[0], by_type = s.b_type[1], bz_type = s.b_type[2];
+
+        const auto gp = getPosition(s);
+        auto* AMREX_RESTRICT Exp = s.Exp.dataPtr();
+        auto* AMREX_RESTRICT Eyp = s.Eyp.dataPtr();
+        auto* AMREX_RESTRICT Ezp = s.Ezp.dataPtr();
+        auto* AMREX_RESTRICT Bxp = s.Bxp.dataPtr();
+        auto* AMREX_RESTRICT Byp = s.Byp.dataPtr();
+        auto* AMREX_RESTRICT Bzp = s.Bzp.dataPtr();
+        const amrex::XDim3 dinv = s.dinv;
+        const amrex::XDim3 xyzmin = s.xyzmin;
+        const amrex::Dim3 lo = s.lo;
+
+        const auto t = timeKernel(repeat, [&] () {
+            amrex::ParallelFor(s.np, [=] AMREX_GPU_DEVICE (long ip) noexcept
+            {
+                amrex::ParticleReal xp, yp, zp;
+                gp(ip, xp, yp, zp);
+                Exp[ip] = 0._prt; Eyp[ip] = 0._prt; Ezp[ip] = 0._prt;
+                Bxp[ip] = 0._prt; Byp[ip] = 0._prt; Bzp[ip] = 0._prt;
+                doGatherShapeN<order,0>(xp, yp, zp, Exp[ip], Eyp[ip], Ezp[ip], Bxp[ip], Byp[ip], Bzp[ip],
+                    ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
+                    ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
+                    dinv, xyzmin, lo, 1);
+            });
+        });
+        results.push_back({"doGatherShapeN", order, s.np, "particles",
+                           t.first, t.second, (n_pos + 6)*sizeof(amrex::ParticleReal)});
+    }
+
+    template <int pusher>
+    void benchPusher (BenchSetup& s, int repeat, std::vector<BenchResult>& results, std::string const& name)
+    {
+        auto* AMREX_RESTRICT uxp = s.ux.dataPtr();
+        auto* AMREX_RESTRICT uyp = s.uy.dataPtr();
+        auto* AMREX_RESTRICT uzp = s.uz.dataPtr();
+        auto* AMREX_RESTRICT Exp = s.Exp.dataPtr();
+        auto* AMREX_RESTRICT Eyp = s.Eyp.dataPtr();
+        auto* AMREX_RESTRICT Ezp = s.Ezp.dataPtr();
+        auto* AMREX_RESTRICT Bxp = s.Bxp.dataPtr();
+        auto* AMREX_RESTRICT Byp = s.Byp.dataPtr();
+        auto* AMREX_RESTRICT Bzp = s.Bzp.dataPtr();
+
+        // The pusher does not depend on the gather benchmark (which may not be selected):
+        // set the fields at the particles to the values used for the gathered fields
+        amrex::ParallelFor(s.np, [=] AMREX_GPU_DEVICE (long ip) noexcept
+        {
+            Exp[ip] = 1.e9_prt; Eyp[ip] = 1.e9_prt; Ezp[ip] = 1.e9_prt;
+            Bxp[ip] = 1._prt; Byp[ip] = 1._prt; Bzp[ip] = 1._prt;
+        });
+        amrex::Gpu::streamSynchronize();
+
+        const amrex::ParticleReal q = -PhysConst::q_e;
+        const amrex::ParticleReal m = PhysConst::m_e;
+        const amrex::Real dt = s.dt;
+
+        const auto t = timeKernel(repeat, [&] () {
+            amrex::ParallelFor(s.np, [=] AMREX_GPU_DEVICE (long ip) noexcept
+            {
+                if constexpr (pusher == static_cast<int>(ParticlePusherAlgo::Boris)) {
+                    UpdateMomentumBoris(uxp[ip], uyp[ip], uzp[ip],
+                        Exp[ip], Eyp[ip], Ezp[ip], Bxp[ip], Byp[ip], Bzp[ip], q, m, dt);
+                } else if constexpr (pusher == static_cast<int>(ParticlePusherAlgo::Vay)) {
+                    UpdateMomentumVay(uxp[ip], uyp[ip], uzp[ip],
+                        Exp[ip], Eyp[ip], Ezp[ip], Bxp[ip], Byp[ip], Bzp[ip], q, m, dt);
+                } else {
+                    UpdateMomentumHigueraCary(uxp[ip], uyp[ip], uzp[ip],
+                        Exp[ip], Eyp[ip], Ezp[ip], Bxp[ip], Byp[ip], Bzp[ip], q, m, dt);
+                }
+            });
+        });
+        results.push_back({name, 0, s.np, "particles",
+                           t.first, t.second, 12.*sizeof(amrex::ParticleReal)});
+    }
+
+    void benchFields (BenchSetup& s, int repeat, std::vector<BenchResult>& results,
+                      std::vector<std::string> const& kernels)
+    {
+        auto selected = [&] (std::string const& name) {
+            return kernels.empty() || std::find(kernels.begin(), kernels.end(), name) != kernels.end();
+        };
+        const amrex::BoxArray ba(s.domain);
+        const amrex::DistributionMapping dm(ba);
+        const amrex::Long ncells = s.domain.numPts();
+        constexpr double sz = sizeof(amrex::Real);
+
+        std::array<std::unique_ptr<amrex::MultiFab>,3> E, B, J;
+        for (int i = 0; i < 3; ++i) {
+            E[i] = std::make_unique<amrex::MultiFab>(amrex::convert(ba, s.e_type[i]), dm, 1, s.ng);
+            B[i] = std::make_unique<amrex::MultiFab>(amrex::convert(ba, s.b_type[i]), dm, 1, s.ng);
+            J[i] = std::make_unique<amrex::MultiFab>(amrex::convert(ba, s.e_type[i]), dm, 1, s.ng);
+            E[i]->setVal(1._rt);
+            B[i]->setVal(1._rt);
+            J[i]->setVal(1._rt);
+        }
+
+#if !defined(WARPX_DIM_RZ)
+        // The cylindrical solver reads the geometry from the WarpX instance
+        FiniteDifferenceSolver fdtd(ElectromagneticSolverAlgo::Yee, s.cell_size,
+                                    ablastr::utils::enums::GridType::Staggered);
+        std::array<std::unique_ptr<amrex::MultiFab>,3> no_field;
+        std::array<std::unique_ptr<amrex::MultiFab>,3> no_ectrho, no_venl;
+        std::array<std::unique_ptr<amrex::iMultiFab>,3> no_flag;
+        std::array<std::unique_ptr<amrex::LayoutData<FaceInfoBox>>,3> no_borrowing;
+        const std::unique_ptr<amrex::MultiFab> no_scalar;
+
+        if (selected("FiniteDifferenceSolver::EvolveE")) {
+            const auto t = timeKernel(repeat, [&] () {
+                fdtd.EvolveE(E, B, J, no_field, no_field, no_ectrho, no_scalar, 0, s.dt);
+            });
+            // read B and J, read and write E
+            results.push_back({"FiniteDifferenceSolver::EvolveE", 0, ncells, "cells",
+                               t.first, t.second, 12*sz});
+        }
+        if (selected("FiniteDifferenceSolver::EvolveB")) {
+            const auto t = timeKernel(repeat, [&] () {
+                fdtd.EvolveB(B, E, no_scalar, no_field, no_field, no_ectrho, no_venl,
+                             no_flag, no_borrowing, 0, s.dt);
+            });
+            // read E, read and write B
+            results.push_back({"FiniteDifferenceSolver::EvolveB", 0, ncells, "cells",
+                               t.first, t.second, 9*sz});
+        }
+#endif
+
+        if (selected("BilinearFilter")) {
+            BilinearFilter filter;
+            filter.npass_each_dir.fill(1u);
+            filter.ComputeStencils();
+            amrex::MultiFab dst(J[0]->boxArray(), dm, 1, s.ng);
+            const auto t = timeKernel(repeat, [&] () {
+                filter.ApplyStencil(dst, *J[0], 0);
+            });
+            // read and write one component
+            results.push_back({"BilinearFilter", 0, ncells, "cells",
+                               t.first, t.second, 2*sz});
+        }
+    }
+
+    template <typename F>
+    void dispatchOrder (int order, F&& f)
+    {
+        switch (order) {
+            case 1: f(std::integral_constant<int,1>{}); break;
+            case 2: f(std::integral_constant<int,2>{}); break;
+            case 3: f(std::integral_constant<int,3>{}); break;
+            case 4: f(std::integral_constant<int,4>{}); break;
+            default:
+                WARPX_ABORT_WITH_MESSAGE("bench.orders must contain shape orders between 1 and 4");
+        }
+    }
+
+    void writeJson (std::string const& filename, BenchSetup const& s, int ppc, int repeat,
+                    std::vector<BenchResult> const& results)
+    {
+        if (!amrex::ParallelDescriptor::IOProcessor()) { return; }
+
+        std::ofstream ofs(filename);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(ofs.is_open(), "Could not open " + filename);
+        ofs << std::setprecision(8);
+        ofs << "{\n";
+        ofs << "  \"dims\": \"" << dims_name << "\",\n";
+#ifdef AMREX_USE_FLOAT
+        ofs << "  \"precision\": \"SINGLE\",\n";
+#else
+        ofs << "  \"precision\": \"DOUBLE\",\n";
+#endif
+#ifdef AMREX_SINGLE_PRECISION_PARTICLES
+        ofs << "  \"particle_precision\": \"SINGLE\",\n";
+#else
+        ofs << "  \"particle_precision\": \"DOUBLE\",\n";
+#endif
+#if defined(AMREX_USE_CUDA)
+        ofs << "  \"compute\": \"CUDA\",\n";
+#elif defined(AMREX_USE_HIP)
+        ofs << "  \"compute\": \"HIP\",\n";
+#elif defined(AMREX_USE_SYCL)
+        ofs << "  \"compute\": \"SYCL\",\n";
+#elif defined(AMREX_USE_OMP)
+        ofs << "  \"compute\": \"OMP\",\n";
+#else
+        ofs << "  \"compute\": \"NOACC\",\n";
+#endif
+        ofs << "  \"omp_threads\": " << amrex::OpenMP::get_max_threads() << ",\n";
+        ofs << "  \"mpi_ranks\": " << amrex::ParallelDescriptor::NProcs() << ",\n";
+        ofs << "  \"n_cell\": [";
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            ofs << (d > 0 ? ", " : "") << s.domain.length(d);
+        }
+        ofs << "],\n";
+        ofs << "  \"guard_cells\": " << s.ng << ",\n";
+        ofs << "  \"ppc\": " << ppc << ",\n";
+        ofs << "  \"repeat\": " << repeat << ",\n";
+        ofs << "  \"results\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            auto const& r = results[i];
+            const double rate = (r.time_min > 0.) ? static_cast<double>(r.n_items)/r.time_min : 0.;
+            ofs << "    {\"kernel\": \"" << r.kernel << "\""
+                << ", \"order\": " << r.order
+                << ", \"n_items\": " << r.n_items
+                << ", \"unit\": \"" << r.unit << "\""
+                << ", \"time_min_s\": " << r.time_min
+                << ", \"time_mean_s\": " << r.time_mean
+                << ", \"items_per_s\": " << rate
+                << ", \"bytes_per_item\": " << r.bytes_per_item
+                << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        ofs << "  ]\n";
+        ofs << "}\n";
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        const amrex::ParmParse pp_bench("bench");
+#if defined(WARPX_DIM_3D)
+        int n_cell = 64;
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+        int n_cell = 256;
+#else
+        int n_cell = 4096;
+#endif
+        int ppc = 8;
+        int repeat = 10;
+        std::vector<int> orders = {1, 2, 3};
+        std::vector<std::string> kernels;
+        std::string output = "warpx_bench.json";
+        pp_bench.query("n_cell", n_cell);
+        pp_bench.query("ppc", ppc);
+        pp_bench.query("repeat", repeat);
+        pp_bench.queryarr("orders", orders);
+        pp_bench.queryarr("kernels", kernels);
+        pp_bench.query("output", output);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(n_cell > 0 && ppc > 0 && repeat > 0,
+            "bench.n_cell, bench.ppc and bench.repeat must be positive");
+
+        BenchSetup s;
+        s.domain = amrex::Box(amrex::IntVect(0), amrex::IntVect(n_cell - 1));
+        // Enough guard cells for the highest shape order and a particle displacement of one cell
+        s.ng = *std::max_element(orders.begin(), orders.end()) + 2;
+        for (int i = 0; i < 3; ++i) {
+            s.e_type[i] = yeeType(i, true);
+            s.b_type[i] = yeeType(i, false);
+        }
+
+        // Same conventions as WarpX::CellSize and WarpX::LowerCorner
+        const amrex::Real dx = 1.e-6_rt;
+        const amrex::Real lowest = std::numeric_limits<amrex::Real>::lowest();
+#if defined(WARPX_DIM_3D)
+        s.cell_size = {dx, dx, dx};
+        s.dinv = amrex::XDim3{1._rt/dx, 1._rt/dx, 1._rt/dx};
+        s.xyzmin = amrex::XDim3{-s.ng*dx, -s.ng*dx, -s.ng*dx};
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+        s.cell_size = {dx, 1._rt, dx};
+        s.dinv = amrex::XDim3{1._rt/dx, 1._rt, 1._rt/dx};
+        s.xyzmin = amrex::XDim3{-s.ng*dx, lowest, -s.ng*dx};
+#else
+        s.cell_size = {1._rt, 1._rt, dx};
+        s.dinv = amrex::XDim3{1._rt, 1._rt, 1._rt/dx};
+        s.xyzmin = amrex::XDim3{lowest, lowest, -s.ng*dx};
+#endif
+#if defined(WARPX_DIM_RZ)
+        // The radial coordinate must be positive: shift the box away from the axis
+        s.xyzmin.x = 0._rt;
+#endif
+        s.lo = amrex::lbound(amrex::grow(s.domain, s.ng));
+        s.dt = 0.5_rt*dx/PhysConst::c;
+
+        initParticles(s, ppc);
+
+        amrex::Print() << "WarpX kernel benchmarks (" << dims_name << "D): "
+                       << n_cell << " cells per direction, " << ppc << " particles per cell, "
+                       << repeat << " repetitions\n";
+
+        std::vector<BenchResult> results;
+        auto selected = [&] (std::string const& name) {
+            return kernels.empty() || std::find(kernels.begin(), kernels.end(), name) != kernels.end();
+        };
+
+        for (const int order : orders) {
+            dispatchOrder(order, [&] (auto o) {
+                constexpr int depos_order = decltype(o)::value;
+                benchDeposition<depos_order>(s, repeat, results, kernels);
+                if (selected("doGatherShapeN")) { benchGather<depos_order>(s, repeat, results); }
+            });
+        }
+        if (selected("UpdateMomentumBoris")) {
+            benchPusher<static_cast<int>(ParticlePusherAlgo::Boris)>(s, repeat, results, "UpdateMomentumBoris");
+        }
+        if (selected("UpdateMomentumVay")) {
+            benchPusher<static_cast<int>(ParticlePusherAlgo::Vay)>(s, repeat, results, "UpdateMomentumVay");
+        }
+        if (selected("UpdateMomentumHigueraCary")) {
+            benchPusher<static_cast<int>(ParticlePusherAlgo::HigueraCary)>(s, repeat, results, "UpdateMomentumHigueraCary");
+        }
+        benchFields(s, repeat, results, kernels);
+
+        for (auto const& r : results) {
+            amrex::Print() << "  " << std::left << std::setw(34) << r.kernel
+                           << " order " << r.order << ": "
+                           << std::setw(12) << r.time_min << " s, "
+                           << static_cast<double>(r.n_items)/r.time_min << " " << r.unit << "/s\n";
+        }
+        writeJson(output, s, ppc, repeat, results);
+        amrex::Print() << "Results written to " << output << "\n";
+    }
+    amrex::Finalize();
+    return 0;
+}
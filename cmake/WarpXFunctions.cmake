@@ -265,6 +265,10 @@ function(set_warpx_binary_name D)
         list(APPEND warpx_bin_names app_${SD})
         set_target_properties(app_${SD} PROPERTIES OUTPUT_NAME "warpx")
     endif()
+    if(WarpX_BENCH)
+        list(APPEND warpx_bin_names bench_${SD})
+        set_target_properties(bench_${SD} PROPERTIES OUTPUT_NAME "warpx_bench")
+    endif()
     if(WarpX_LIB)
         list(APPEND warpx_bin_names lib_${SD})
         # On WIN32, the OUTPUT_NAME must not collide between lib and app!
@@ -449,6 +453,7 @@ function(warpx_print_summary)
     message("  Build options:")
     message("    APP: ${WarpX_APP}")
     message("    ASCENT: ${WarpX_ASCENT}")
+    message("    BENCH: ${WarpX_BENCH}")
     message("    CATALYST: ${WarpX_CATALYST}")
     message("    COMPUTE: ${WarpX_COMPUTE}")
     message("    DIMS: ${WarpX_DIMS}")